@@ -1,6 +1,20 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
+namespace
+{
+    // Deterministic 0-1 value per grain clock grid point, so chaos jitter on the
+    // tempo-locked clock doesn't depend on where block boundaries fall
+    float gridJitter(juce::int64 gridIndex)
+    {
+        auto x = static_cast<juce::uint64>(gridIndex) * 0x9E3779B97F4A7C15ull;
+        x ^= x >> 31;
+        x *= 0xBF58476D1CE4E5B9ull;
+        x ^= x >> 29;
+        return static_cast<float>(x >> 40) / 16777216.0f;  // Top 24 bits -> [0, 1)
+    }
+}
+
 juce::AudioProcessorValueTreeState::ParameterLayout AngelGrainAudioProcessor::createParameterLayout()
 {
     juce::AudioProcessorValueTreeState::ParameterLayout layout;
@@ -75,6 +89,15 @@ AngelGrainAudioProcessor::AngelGrainAudioProcessor()
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
+    delayTimeParam = parameters.getRawParameterValue("delayTime");
+    grainSizeParam = parameters.getRawParameterValue("grainSize");
+    feedbackParam = parameters.getRawParameterValue("feedback");
+    chaosParam = parameters.getRawParameterValue("chaos");
+    characterParam = parameters.getRawParameterValue("character");
+    mixParam = parameters.getRawParameterValue("mix");
+    tempoSyncParam = parameters.getRawParameterValue("tempoSync");
+
+    buildWindowTable();
 }
 
 AngelGrainAudioProcessor::~AngelGrainAudioProcessor()
@@ -99,13 +122,6 @@ void AngelGrainAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
     // Note: Using manual linear dry/wet mixing instead of DryWetMixer
     // for more intuitive behavior at 50% (full dry + full wet)
 
-    // Pre-calculate Hann window table
-    for (int i = 0; i < windowTableSize; ++i)
-    {
-        float x = static_cast<float>(i) / static_cast<float>(windowTableSize - 1);
-        hannWindow[i] = 0.5f * (1.0f - std::cos(2.0f * juce::MathConstants<float>::pi * x));
-    }
-
     // Reset all grain voices
     for (auto& voice : grainVoices)
     {
@@ -116,8 +132,13 @@ void AngelGrainAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
         voice.pan = 0.5f;
         voice.grainLengthSamples = 0;
         voice.pitchSemitones = 0;
+        voice.fadeGain = 1.0f;
+        voice.fadeStep = 0.0f;
     }
 
+    grainAllocator.reset();
+    stealFadeStep = 1.0f / static_cast<float>(sampleRate * 0.002);
+
     // Reset scheduler
     samplesSinceLastGrain = 0;
     writePosition = 0;
@@ -125,13 +146,16 @@ void AngelGrainAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
     feedbackSampleR = 0.0f;
 
     // Calculate initial grain interval from delayTime parameter
-    auto* delayTimeParam = parameters.getRawParameterValue("delayTime");
     float delayTimeMs = delayTimeParam->load();
     nextGrainInterval = static_cast<int>((delayTimeMs / 1000.0f) * sampleRate);
 
-    // Pre-allocate stereo buffers for real-time safety
-    wetBuffer.setSize(2, samplesPerBlock);
-    dryBuffer.setSize(2, samplesPerBlock);
+    // Mix ramps start from the current setting
+    previousMixValue = mixParam->load() / 100.0f;
+
+    // Grains read up to maxDelaySeconds back, so the output may be quiet for that
+    // long (plus one grain) while audio is still pending in the buffer
+    tailTracker.prepare(sampleRate);
+    tailTracker.setQuietHoldSeconds(maxDelaySeconds + 0.5);
 }
 
 void AngelGrainAudioProcessor::releaseResources()
@@ -145,34 +169,34 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
 
     const int numSamples = buffer.getNumSamples();
 
-    // Ensure buffers are large enough (in case host uses different block size)
-    if (wetBuffer.getNumSamples() < numSamples)
-    {
-        wetBuffer.setSize(2, numSamples, false, false, true);
-        dryBuffer.setSize(2, numSamples, false, false, true);
-    }
-
-    // Read parameters atomically
-    auto* delayTimeParam = parameters.getRawParameterValue("delayTime");
-    auto* mixParam = parameters.getRawParameterValue("mix");
-    auto* feedbackParam = parameters.getRawParameterValue("feedback");
-    auto* characterParam = parameters.getRawParameterValue("character");
-    auto* chaosParam = parameters.getRawParameterValue("chaos");
-    auto* tempoSyncParam = parameters.getRawParameterValue("tempoSync");
+    // Offline bounce: allow more overlapping grains before stealing
+    renderQuality.update(*this);
+    grainAllocator.setVoiceLimit(renderQuality.select(maxGrainVoices, maxOfflineGrainVoices));
 
+    // Read parameters atomically (cached handles, no lookups)
     float delayTimeMs = delayTimeParam->load();
     float mixValue = mixParam->load() / 100.0f;
     float feedbackGain = (feedbackParam->load() / 100.0f) * 0.95f;  // Map 0-100% to 0-0.95
     float characterAmount = characterParam->load() / 100.0f;
     float chaosAmount = chaosParam->load() / 100.0f;
     bool tempoSyncEnabled = tempoSyncParam->load() > 0.5f;
+    float grainSizeMs = grainSizeParam->load();
+
+    // Spawn settings are block-constant: work them out once here, not per grain.
+    // Grains read from the unquantized delay time (tempo sync only affects spawn timing).
+    GrainSpawnSettings spawnSettings;
+    spawnSettings.grainLengthSamples = juce::jmax(1, static_cast<int>((grainSizeMs / 1000.0f) * currentSampleRate));
+    spawnSettings.delayTimeSamples = (delayTimeMs / 1000.0f) * static_cast<float>(currentSampleRate);
+    spawnSettings.chaosAmount = chaosAmount;
 
     // Tempo sync: quantize delay time to note divisions
+    double bpm = 120.0;  // Default BPM
+    juce::Optional<double> hostPpq;
+    bool hostIsPlaying = false;
+
     if (tempoSyncEnabled)
     {
-        double bpm = 120.0;  // Default BPM
-
-        // Query host for tempo
+        // Query host for tempo and transport position
         if (auto* playHead = getPlayHead())
         {
             if (auto position = playHead->getPosition())
@@ -183,6 +207,9 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
                     // Clamp to valid range
                     bpm = juce::jlimit(20.0, 300.0, bpm);
                 }
+
+                hostPpq = position->getPpqPosition();
+                hostIsPlaying = position->getIsPlaying();
             }
         }
 
@@ -192,6 +219,41 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
     // Character morphing: density multiplier (1.0 to 4.0)
     float densityMultiplier = 1.0f + (characterAmount * 3.0f);
 
+    // Tempo-locked grain clock: while the transport runs, grains spawn on the host's beat
+    // grid (grid point k sits at k * gridIntervalBeats from ppq 0), worked out from this
+    // block's ppqPosition. Each onset lands on the first sample at or after its grid time,
+    // so transport jumps re-align immediately and any buffer size gives the same result.
+    // Chaos delays each onset by a deterministic per-point amount (up to half an interval).
+    const bool tempoLocked = tempoSyncEnabled && hostIsPlaying && hostPpq.hasValue();
+    double blockStartPpq = 0.0;
+    double gridIntervalBeats = 1.0;
+    double samplesPerBeat = 1.0;
+    juce::int64 gridIndex = 0;
+    double nextLockedSpawn = 0.0;
+
+    auto lockedSpawnOffset = [&](juce::int64 k)
+    {
+        const double jitterBeats = gridJitter(k) * chaosAmount * 0.5 * gridIntervalBeats;
+        return std::ceil((static_cast<double>(k) * gridIntervalBeats + jitterBeats - blockStartPpq) * samplesPerBeat);
+    };
+
+    if (tempoLocked)
+    {
+        blockStartPpq = *hostPpq;
+        samplesPerBeat = currentSampleRate * 60.0 / bpm;
+
+        // Whole-number density keeps onsets on musical subdivisions of the note value
+        const double msPerBeat = 60000.0 / bpm;
+        gridIntervalBeats = (delayTimeMs / msPerBeat) / std::round(densityMultiplier);
+
+        // First onset not already played in an earlier block (jitter can push one across)
+        gridIndex = static_cast<juce::int64>(std::floor(blockStartPpq / gridIntervalBeats)) - 1;
+        while (lockedSpawnOffset(gridIndex) < 0.0)
+            ++gridIndex;
+
+        nextLockedSpawn = lockedSpawnOffset(gridIndex);
+    }
+
     // Calculate spawn interval in samples from delay time with density adjustment
     float baseIntervalSamples = (delayTimeMs / 1000.0f) * static_cast<float>(currentSampleRate);
     nextGrainInterval = static_cast<int>(baseIntervalSamples / densityMultiplier);
@@ -201,56 +263,83 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
     // Calculate Tukey window alpha for character control (0.1 to 1.0)
     float tukeyAlpha = 0.1f + (characterAmount * 0.9f);
 
-    // Get stereo input pointers
-    const float* inputL = buffer.getReadPointer(0);
-    const float* inputR = buffer.getNumChannels() > 1 ? buffer.getReadPointer(1) : buffer.getReadPointer(0);
+    // Tail: feedback loop (one delay time per pass, chaos jitter up to +25%) decaying by
+    // 60dB, plus the last grain
+    const double grainSeconds = grainSizeMs / 1000.0;
+    const double loopSeconds = juce::jmin(static_cast<double>(maxDelaySeconds), delayTimeMs / 1000.0 * 1.25);
+    tailTracker.setTailLengthSeconds(TailTracker::feedbackTailSeconds(loopSeconds, feedbackGain) + grainSeconds);
 
-    // Clear wet buffer
-    wetBuffer.clear();
+    // Idle: input silent and the tail has died away - skip all DSP
+    if (tailTracker.processInput(buffer, getTotalNumInputChannels()))
+        return;
 
-    // Store dry signal for later mixing (preserve stereo field)
-    for (int i = 0; i < numSamples; ++i)
-    {
-        dryBuffer.setSample(0, i, inputL[i]);
-        dryBuffer.setSample(1, i, inputR[i]);
-    }
+    // Mixed in place: each sample's input is read before its output overwrites it
+    float* channelL = buffer.getWritePointer(0);
+    float* channelR = buffer.getNumChannels() > 1 ? buffer.getWritePointer(1) : nullptr;
 
-    // Process sample by sample
+    // Linear dry/wet mix (full dry + scaled wet for 0-100%)
+    // At 0%: dry only, At 100%: wet only, At 50%: full dry + full wet
+    // The wet gain ramps linearly from last block's setting so mix moves don't zipper.
+    const float mixStep = (mixValue - previousMixValue) / static_cast<float>(juce::jmax(1, numSamples));
+    float currentMix = previousMixValue;
+    previousMixValue = mixValue;
+
+    // Process sample by sample (the feedback path makes the wet signal inherently serial,
+    // so the crossfade is folded into this pass rather than run over staging buffers)
     for (int sample = 0; sample < numSamples; ++sample)
     {
+        const float dryL = channelL[sample];
+        const float dryR = channelR != nullptr ? channelR[sample] : dryL;
+
         // Mix feedback with input before writing to grain buffer (stereo)
-        float inputWithFeedbackL = inputL[sample] + feedbackSampleL;
-        float inputWithFeedbackR = inputR[sample] + feedbackSampleR;
+        float inputWithFeedbackL = dryL + feedbackSampleL;
+        float inputWithFeedbackR = dryR + feedbackSampleR;
 
         // Write to grain buffer (stereo input + feedback)
         grainBuffer.pushSample(0, inputWithFeedbackL);
         grainBuffer.pushSample(1, inputWithFeedbackR);
 
-        // Calculate grain interval with chaos timing jitter
-        int currentInterval = nextGrainInterval;
-        if (chaosAmount > 0.01f)
+        samplesSinceLastGrain++;
+
+        if (tempoLocked)
         {
-            float timingJitter = (random.nextFloat() - 0.5f) * chaosAmount;
-            currentInterval = static_cast<int>(nextGrainInterval * (1.0f + timingJitter));
-            currentInterval = std::max(1, currentInterval);
+            // Tempo-locked: spawn when the next grid onset is reached
+            if (static_cast<double>(sample) >= nextLockedSpawn)
+            {
+                spawnGrain(spawnSettings);
+                samplesSinceLastGrain = 0;
+                nextLockedSpawn = lockedSpawnOffset(++gridIndex);
+            }
         }
-
-        // Check if we should spawn a new grain
-        samplesSinceLastGrain++;
-        if (samplesSinceLastGrain >= currentInterval && currentInterval > 0)
+        else
         {
-            spawnGrain();
-            samplesSinceLastGrain = 0;
+            // Free-running (sync off or transport stopped)
+            // Calculate grain interval with chaos timing jitter
+            int currentInterval = nextGrainInterval;
+            if (chaosAmount > 0.01f)
+            {
+                float timingJitter = (random.nextFloat() - 0.5f) * chaosAmount;
+                currentInterval = static_cast<int>(nextGrainInterval * (1.0f + timingJitter));
+                currentInterval = std::max(1, currentInterval);
+            }
+
+            // Check if we should spawn a new grain
+            if (samplesSinceLastGrain >= currentInterval && currentInterval > 0)
+            {
+                spawnGrain(spawnSettings);
+                samplesSinceLastGrain = 0;
+            }
         }
 
         // Process all active grain voices
         float leftOutput = 0.0f;
         float rightOutput = 0.0f;
 
-        for (auto& voice : grainVoices)
+        // Backwards over the playing list so finished grains can be released in place
+        for (int i = grainAllocator.getNumPlaying(); --i >= 0;)
         {
-            if (!voice.active)
-                continue;
+            const int voiceIndex = grainAllocator.getPlaying(i);
+            auto& voice = grainVoices[static_cast<size_t>(voiceIndex)];
 
             // Read from delay buffer with interpolation (stereo)
             float delaySamples = std::max(0.0f, voice.readPosition);
@@ -258,34 +347,34 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
             float grainSampleR = grainBuffer.popSample(1, delaySamples, false);
 
             // Apply window envelope with Tukey alpha (character control)
-            float windowGain = getWindowSample(voice.windowPosition, tukeyAlpha);
+            float windowGain = getWindowSample(voice.windowPosition, tukeyAlpha) * voice.fadeGain;
             float processedL = grainSampleL * windowGain;
             float processedR = grainSampleR * windowGain;
 
-            // Apply equal-power pan crossfade between stereo channels
-            // Pan 0.0 = full left channel, 0.5 = balanced, 1.0 = full right channel
-            float leftGain = std::cos(voice.pan * juce::MathConstants<float>::halfPi);
-            float rightGain = std::sin(voice.pan * juce::MathConstants<float>::halfPi);
-
-            // Crossfade: at pan=0.5, both channels contribute equally
-            // This preserves stereo field while allowing pan randomization
-            leftOutput += (processedL * leftGain + processedR * (1.0f - rightGain)) * 0.707f;
-            rightOutput += (processedR * rightGain + processedL * (1.0f - leftGain)) * 0.707f;
+            // Pan crossfade via the grain's precomputed cross-feed matrix
+            leftOutput += processedL * voice.gainLL + processedR * voice.gainRL;
+            rightOutput += processedL * voice.gainLR + processedR * voice.gainRR;
 
             // Advance grain playback (decrease delay to read more recent audio)
             voice.readPosition -= voice.playbackRate;
 
             // Advance window position
-            float windowIncrement = 1.0f / static_cast<float>(voice.grainLengthSamples);
-            voice.windowPosition += windowIncrement;
+            voice.windowPosition += voice.windowIncrement;
 
-            // Check if grain has finished (window complete or read position invalid)
-            if (voice.windowPosition >= 1.0f || voice.readPosition < 0.0f)
+            // Stolen grains ramp out over a couple of milliseconds
+            voice.fadeGain -= voice.fadeStep;
+
+            // Check if grain has finished (window complete, read position invalid or faded out)
+            if (voice.windowPosition >= 1.0f || voice.readPosition < 0.0f || voice.fadeGain <= 0.0f)
             {
                 voice.active = false;
+                grainAllocator.release(voiceIndex);
             }
         }
 
+        // Grain end times are kept on the allocator's clock
+        grainAllocator.advance(1);
+
         // Apply feedback gain and soft saturation (stereo)
         float feedbackL = leftOutput * feedbackGain;
         float feedbackR = rightOutput * feedbackGain;
@@ -299,26 +388,14 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
         feedbackSampleL = feedbackL;
         feedbackSampleR = feedbackR;
 
-        // Write to wet buffer
-        wetBuffer.setSample(0, sample, leftOutput);
-        wetBuffer.setSample(1, sample, rightOutput);
+        // Crossfade straight into the host buffer: dry + (wet - dry) * mix
+        currentMix += mixStep;
+        channelL[sample] = dryL + (leftOutput - dryL) * currentMix;
+        if (channelR != nullptr)
+            channelR[sample] = dryR + (rightOutput - dryR) * currentMix;
     }
 
-    // Linear dry/wet mix (full dry + scaled wet for 0-100%)
-    // At 0%: dry only, At 100%: wet only, At 50%: full dry + full wet
-    float dryGain = 1.0f - mixValue;  // 1.0 at 0%, 0.0 at 100%
-    float wetGain = mixValue;          // 0.0 at 0%, 1.0 at 100%
-
-    for (int i = 0; i < numSamples; ++i)
-    {
-        float dryL = dryBuffer.getSample(0, i);
-        float dryR = dryBuffer.getSample(1, i);
-        float wetL = wetBuffer.getSample(0, i);
-        float wetR = wetBuffer.getSample(1, i);
-
-        buffer.setSample(0, i, dryL * dryGain + wetL * wetGain);
-        buffer.setSample(1, i, dryR * dryGain + wetR * wetGain);
-    }
+    tailTracker.processOutput(buffer);
 }
 
 juce::AudioProcessorEditor* AngelGrainAudioProcessor::createEditor()
@@ -341,32 +418,30 @@ void AngelGrainAudioProcessor::setStateInformation(const void* data, int sizeInB
         parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
-void AngelGrainAudioProcessor::spawnGrain()
+void AngelGrainAudioProcessor::spawnGrain(const GrainSpawnSettings& settings)
 {
-    // Find a free voice
-    int voiceIndex = findFreeVoice();
-    if (voiceIndex < 0)
-        return;  // All voices busy
+    // Take a free voice; when all are sounding, the grain nearest its end fades out
+    int voiceIndex = grainAllocator.allocate(
+        settings.grainLengthSamples,
+        [this](int index)
+        {
+            grainVoices[static_cast<size_t>(index)].fadeStep = stealFadeStep;
+        });
+
+    if (voiceIndex == GrainAllocator<grainPoolSize>::noSlot)
+        return;  // Even the fade-out reserve is busy
 
     auto& voice = grainVoices[static_cast<size_t>(voiceIndex)];
 
-    // Read parameters
-    auto* grainSizeParam = parameters.getRawParameterValue("grainSize");
-    auto* delayTimeParam = parameters.getRawParameterValue("delayTime");
-    auto* chaosParam = parameters.getRawParameterValue("chaos");
+    const float chaosAmount = settings.chaosAmount;
 
-    float grainSizeMs = grainSizeParam->load();
-    float delayTimeMs = delayTimeParam->load();
-    float chaosAmount = chaosParam->load() / 100.0f;  // Normalize to 0.0-1.0
-
-    // Calculate grain length in samples
-    voice.grainLengthSamples = static_cast<int>((grainSizeMs / 1000.0f) * currentSampleRate);
-    if (voice.grainLengthSamples < 1)
-        voice.grainLengthSamples = 1;
+    // Grain length in samples (block-constant)
+    voice.grainLengthSamples = settings.grainLengthSamples;
+    voice.windowIncrement = 1.0f / static_cast<float>(voice.grainLengthSamples);
 
     // Calculate read position (how far back in the buffer to read)
     // Read from delayTime back in the buffer
-    float delayTimeSamples = (delayTimeMs / 1000.0f) * static_cast<float>(currentSampleRate);
+    float delayTimeSamples = settings.delayTimeSamples;
 
     // Apply position randomization based on chaos
     // Formula: position = basePosition * (1.0 + (random - 0.5) * (chaos / 100) * 0.5)
@@ -393,6 +468,18 @@ void AngelGrainAudioProcessor::spawnGrain()
     // Clamp pan to valid range
     voice.pan = juce::jlimit(0.0f, 1.0f, voice.pan);
 
+    // Equal-power pan crossfade between stereo channels, folded into a cross-feed matrix
+    // Pan 0.0 = full left channel, 0.5 = balanced, 1.0 = full right channel
+    // At pan=0.5 both channels contribute equally, preserving the stereo field
+    const float leftGain = std::cos(voice.pan * juce::MathConstants<float>::halfPi);
+    const float rightGain = std::sin(voice.pan * juce::MathConstants<float>::halfPi);
+    voice.gainLL = leftGain * 0.707f;
+    voice.gainRL = (1.0f - rightGain) * 0.707f;
+    voice.gainLR = (1.0f - leftGain) * 0.707f;
+    voice.gainRR = rightGain * 0.707f;
+
+    voice.fadeGain = 1.0f;
+    voice.fadeStep = 0.0f;
     voice.active = true;
 }
 
@@ -438,51 +525,54 @@ float AngelGrainAudioProcessor::calculatePlaybackRate(int semitones)
     return std::pow(2.0f, static_cast<float>(semitones) / 12.0f);
 }
 
-float AngelGrainAudioProcessor::getWindowSample(float normalizedPosition, float tukeyAlpha)
+void AngelGrainAudioProcessor::buildWindowTable()
 {
-    // Clamp position to valid range
-    if (normalizedPosition < 0.0f)
-        normalizedPosition = 0.0f;
-    if (normalizedPosition >= 1.0f)
-        normalizedPosition = 0.9999f;
-
-    // Tukey window formula:
-    // - alpha = 0.1: short crossfades (10% on each side), glitchy character
-    // - alpha = 1.0: full Hann envelope, smooth character
-    float x = normalizedPosition;
-    float windowValue;
-
-    if (x < tukeyAlpha / 2.0f)
-    {
-        // Cosine rise (attack)
-        windowValue = 0.5f * (1.0f - std::cos(2.0f * juce::MathConstants<float>::pi * x / tukeyAlpha));
-    }
-    else if (x < 1.0f - tukeyAlpha / 2.0f)
-    {
-        // Flat top
-        windowValue = 1.0f;
-    }
-    else
+    windowTable.assign(static_cast<size_t>((windowTableRows + 1) * windowTableStride), 0.0f);
+
+    for (int row = 0; row <= windowTableRows; ++row)
     {
-        // Cosine fall (release)
-        windowValue = 0.5f * (1.0f - std::cos(2.0f * juce::MathConstants<float>::pi * (1.0f - x) / tukeyAlpha));
-    }
+        // Guard row repeats the last alpha
+        const int alphaIndex = juce::jmin(row, windowTableRows - 1);
+        const float tukeyAlpha = 0.1f + 0.9f * static_cast<float>(alphaIndex) / static_cast<float>(windowTableRows - 1);
+
+        for (int i = 0; i <= windowTableSize; ++i)
+        {
+            // First half of the window: x = 0 (grain start) to 0.5 (centre)
+            const float x = 0.5f * static_cast<float>(juce::jmin(i, windowTableSize - 1)) / static_cast<float>(windowTableSize - 1);
+
+            // Tukey window formula:
+            // - alpha = 0.1: short crossfades (10% on each side), glitchy character
+            // - alpha = 1.0: full Hann envelope, smooth character
+            const float windowValue = (x < tukeyAlpha / 2.0f)
+                ? 0.5f * (1.0f - std::cos(2.0f * juce::MathConstants<float>::pi * x / tukeyAlpha))  // Cosine rise
+                : 1.0f;                                                                            // Flat top
 
-    return windowValue;
+            windowTable[static_cast<size_t>(row * windowTableStride + i)] = windowValue;
+        }
+    }
 }
 
-int AngelGrainAudioProcessor::findFreeVoice()
+float AngelGrainAudioProcessor::getWindowSample(float normalizedPosition, float tukeyAlpha) const
 {
-    // Linear search for inactive voice
-    for (int i = 0; i < maxGrainVoices; ++i)
-    {
-        if (!grainVoices[static_cast<size_t>(i)].active)
-            return i;
-    }
+    // Symmetric window: fold the release half onto the attack half
+    const float position = juce::jlimit(0.0f, 1.0f, normalizedPosition);
+    const float halfPosition = juce::jmin(position, 1.0f - position) * 2.0f;  // 0 at the edges, 1 at the centre
+
+    // Bilinear lookup: grain phase across columns, character (alpha 0.1-1.0) across rows
+    const float column = halfPosition * static_cast<float>(windowTableSize - 1);
+    const float row = juce::jlimit(0.0f, 1.0f, (tukeyAlpha - 0.1f) / 0.9f) * static_cast<float>(windowTableRows - 1);
+
+    const int columnIndex = static_cast<int>(column);
+    const int rowIndex = static_cast<int>(row);
+    const float columnFrac = column - static_cast<float>(columnIndex);
+    const float rowFrac = row - static_cast<float>(rowIndex);
+
+    const float* row0 = windowTable.data() + rowIndex * windowTableStride + columnIndex;
+    const float* row1 = row0 + windowTableStride;
 
-    // All voices busy - steal oldest (voice 0 for simplicity)
-    // In future phases, could track age for proper voice stealing
-    return 0;
+    const float value0 = row0[0] + columnFrac * (row0[1] - row0[0]);
+    const float value1 = row1[0] + columnFrac * (row1[1] - row1[0]);
+    return value0 + rowFrac * (value1 - value0);
 }
 
 float AngelGrainAudioProcessor::quantizeDelayTimeToTempo(float delayTimeMs, double bpm)
@@ -1,6 +1,9 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "TailTracker.h"
+#include "RenderQuality.h"
+#include "GrainAllocator.h"
 
 // Grain voice structure for polyphonic grain management
 struct GrainVoice
@@ -12,6 +15,17 @@ struct GrainVoice
     int grainLengthSamples = 0;     // Length of this grain in samples
     int pitchSemitones = 0;         // Pitch shift in semitones
     bool active = false;            // Whether this voice is currently playing
+
+    // Precomputed at spawn so the per-sample loop is pure multiply-add
+    float windowIncrement = 0.0f;   // 1 / grainLengthSamples
+    float gainLL = 0.707f;          // Stereo cross-feed matrix (constant-power pan, -3dB)
+    float gainRL = 0.0f;            //   out L = in L * gainLL + in R * gainRL
+    float gainLR = 0.0f;            //   out R = in L * gainLR + in R * gainRR
+    float gainRR = 0.707f;
+
+    // Quick fade-out when the voice is stolen (fadeStep 0 = not fading)
+    float fadeGain = 1.0f;
+    float fadeStep = 0.0f;
 };
 
 class AngelGrainAudioProcessor : public juce::AudioProcessor
@@ -31,7 +45,7 @@ public:
     bool acceptsMidi() const override { return false; }
     bool producesMidi() const override { return false; }
     bool isMidiEffect() const override { return false; }
-    double getTailLengthSeconds() const override { return 0.0; }
+    double getTailLengthSeconds() const override { return tailTracker.getTailLengthSeconds(); }
 
     int getNumPrograms() override { return 1; }
     int getCurrentProgram() override { return 0; }
@@ -47,6 +61,23 @@ public:
 private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
+    // Cached parameter handles (looked up once in the constructor)
+    std::atomic<float>* delayTimeParam = nullptr;
+    std::atomic<float>* grainSizeParam = nullptr;
+    std::atomic<float>* feedbackParam = nullptr;
+    std::atomic<float>* chaosParam = nullptr;
+    std::atomic<float>* characterParam = nullptr;
+    std::atomic<float>* mixParam = nullptr;
+    std::atomic<float>* tempoSyncParam = nullptr;
+
+    // Spawn settings that stay constant for a whole block (computed in processBlock)
+    struct GrainSpawnSettings
+    {
+        int grainLengthSamples = 1;
+        float delayTimeSamples = 0.0f;
+        float chaosAmount = 0.0f;
+    };
+
     // DSP Components
     juce::dsp::ProcessSpec spec;
 
@@ -55,17 +86,28 @@ private:
     static constexpr int maxDelaySeconds = 2;
     int writePosition = 0;
 
-    // Grain voice engine (32 polyphonic voices)
+    // Grain voice engine (32 polyphonic voices live, 64 while bouncing offline),
+    // plus a few reserve slots where stolen grains fade out
     static constexpr int maxGrainVoices = 32;
-    std::array<GrainVoice, maxGrainVoices> grainVoices;
+    static constexpr int maxOfflineGrainVoices = 64;
+    static constexpr int grainReserveSlots = 4;
+    static constexpr int grainPoolSize = maxOfflineGrainVoices + grainReserveSlots;
+    std::array<GrainVoice, grainPoolSize> grainVoices;
+    GrainAllocator<grainPoolSize> grainAllocator;
+    float stealFadeStep = 0.0f;  // Per-sample fade for stolen grains (~2ms)
+    RenderQuality renderQuality;
 
     // Grain scheduler
     int samplesSinceLastGrain = 0;
     int nextGrainInterval = 0;
 
-    // Hann window table for grain envelopes
-    static constexpr int windowTableSize = 4096;
-    std::array<float, windowTableSize> hannWindow;
+    // Tukey window family for grain envelopes: rows span tukeyAlpha 0.1-1.0, columns
+    // the first half of the window (it's symmetric). One guard row/column each so
+    // bilinear lookups never need clamping. Independent of sample rate - built once.
+    static constexpr int windowTableRows = 32;
+    static constexpr int windowTableSize = 512;
+    static constexpr int windowTableStride = windowTableSize + 1;
+    std::vector<float> windowTable;
 
     // Note: Using manual linear dry/wet mixing for intuitive 50% behavior
 
@@ -75,18 +117,20 @@ private:
     // Current sample rate for calculations
     double currentSampleRate = 44100.0;
 
-    // Pre-allocated buffers for real-time safety
-    juce::AudioBuffer<float> wetBuffer;
-    juce::AudioBuffer<float> dryBuffer;
+    // Mix setting at the end of the previous block (start of this block's ramp)
+    float previousMixValue = 0.5f;
 
     // Feedback buffer for feedback loop (stereo)
     float feedbackSampleL = 0.0f;
     float feedbackSampleR = 0.0f;
 
+    // Tail length for the host + idle bypass once input and tail are silent
+    TailTracker tailTracker;
+
     // Helper methods
-    void spawnGrain();
-    float getWindowSample(float normalizedPosition, float tukeyAlpha);
-    int findFreeVoice();
+    void spawnGrain(const GrainSpawnSettings& settings);
+    void buildWindowTable();
+    float getWindowSample(float normalizedPosition, float tukeyAlpha) const;
     int selectPitchShift(float chaosAmount);
     float calculatePlaybackRate(int semitones);
     float quantizeDelayTimeToTempo(float delayTimeMs, double bpm);
@@ -0,0 +1,94 @@
+#include "LookaheadLimiter.h"
+
+//==============================================================================
+void SlidingMaximum::prepare(int windowLength)
+{
+    capacity = juce::jmax(1, windowLength);
+    values.assign(static_cast<size_t>(capacity), 0.0f);
+    positions.assign(static_cast<size_t>(capacity), 0);
+    reset();
+}
+
+void SlidingMaximum::reset()
+{
+    head = 0;
+    size = 0;
+    sampleIndex = 0;
+}
+
+float SlidingMaximum::push(float value)
+{
+    // Expire the front once it has slid out of the window
+    if (size > 0 && positions[static_cast<size_t>(head)] <= sampleIndex - capacity)
+    {
+        head = (head + 1) % capacity;
+        --size;
+    }
+
+    // Queued values no larger than the new one can never be the maximum again
+    while (size > 0)
+    {
+        const int back = (head + size - 1) % capacity;
+        if (values[static_cast<size_t>(back)] > value)
+            break;
+        --size;
+    }
+
+    const int tail = (head + size) % capacity;
+    values[static_cast<size_t>(tail)] = value;
+    positions[static_cast<size_t>(tail)] = sampleIndex;
+    ++size;
+    ++sampleIndex;
+
+    return values[static_cast<size_t>(head)];
+}
+
+//==============================================================================
+void LookaheadGainComputer::prepare(double sampleRate, int lookaheadSamples)
+{
+    lookahead = juce::jmax(1, lookaheadSamples);
+
+    // Window includes the sample now entering the delay and the one leaving it
+    peakHold.prepare(lookahead + 1);
+    averageHistory.assign(static_cast<size_t>(lookahead), 1.0f);
+
+    // Release: 50ms time constant (matches the makeup gain smoothing)
+    releaseCoeff = 1.0f - std::exp(-1.0f / (static_cast<float>(sampleRate) * 0.05f));
+
+    reset();
+}
+
+void LookaheadGainComputer::reset()
+{
+    peakHold.reset();
+    std::fill(averageHistory.begin(), averageHistory.end(), 1.0f);
+    averagePosition = 0;
+    averageSum = static_cast<double>(lookahead);
+    heldGain = 1.0f;
+}
+
+void LookaheadGainComputer::process(const float* levels, float* gains, int numSamples, float ceiling)
+{
+    const double averageScale = 1.0 / static_cast<double>(lookahead);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        // 1. Gain the loudest sample within the look-ahead window needs
+        const float peak = peakHold.push(levels[i]);
+        const float requiredGain = peak > ceiling ? ceiling / peak : 1.0f;
+
+        // 2. Drop instantly, recover smoothly (never above the required gain)
+        if (requiredGain < heldGain)
+            heldGain = requiredGain;
+        else
+            heldGain += (requiredGain - heldGain) * releaseCoeff;
+
+        // 3. Moving average spreads each drop over the look-ahead as a linear ramp
+        auto& oldest = averageHistory[static_cast<size_t>(averagePosition)];
+        averageSum += static_cast<double>(heldGain) - static_cast<double>(oldest);
+        oldest = heldGain;
+        averagePosition = (averagePosition + 1) % lookahead;
+
+        gains[i] = static_cast<float>(averageSum * averageScale);
+    }
+}
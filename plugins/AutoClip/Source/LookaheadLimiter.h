@@ -0,0 +1,59 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <vector>
+
+// Running maximum over the last windowLength values.
+//
+// Monotonic deque kept in fixed ring buffers: each push drops the queued
+// values it dominates from the back and the expired one from the front, so
+// every value enters and leaves once - O(1) amortised per sample, no
+// allocation after prepare().
+class SlidingMaximum
+{
+public:
+    void prepare(int windowLength);
+    void reset();
+
+    // Adds a value and returns the maximum of the last windowLength values
+    float push(float value);
+
+private:
+    std::vector<float> values;
+    std::vector<juce::int64> positions;  // Sample index each queued value arrived at
+    int capacity = 1;
+    int head = 0;                        // Front of the deque (current maximum)
+    int size = 0;
+    juce::int64 sampleIndex = 0;
+};
+
+// Look-ahead gain computer for a peak ceiling.
+//
+// Fed the (stereo-linked) input level before the look-ahead delay, it
+// produces a gain for the delayed audio that is already down to
+// ceiling / peak when each peak comes out of the delay:
+//   1. sliding maximum over lookahead+1 samples -> required gain
+//   2. instant attack, exponential release on that gain
+//   3. moving average over lookahead samples -> smooth linear attack ramp
+// Every averaged sample still covers the peak, so the ramp never overshoots.
+class LookaheadGainComputer
+{
+public:
+    void prepare(double sampleRate, int lookaheadSamples);
+    void reset();
+
+    int getLatencySamples() const { return lookahead; }
+
+    // levels: linked |input| per sample; gains: per-sample gain for the delayed audio
+    void process(const float* levels, float* gains, int numSamples, float ceiling);
+
+private:
+    SlidingMaximum peakHold;
+
+    std::vector<float> averageHistory;   // Last `lookahead` held gains (ring)
+    int averagePosition = 0;
+    double averageSum = 0.0;
+
+    int lookahead = 0;
+    float releaseCoeff = 0.0f;
+    float heldGain = 1.0f;
+};
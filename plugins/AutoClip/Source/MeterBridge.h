@@ -0,0 +1,80 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+
+// Meter values handed from the audio thread to the editor without locks.
+//
+// processBlock accumulates into atomics (peaks and gain reduction as running
+// maxima, clips as counts); the editor's timer takes everything gathered
+// since its last read and clears it in the same exchange. Nothing allocates
+// and neither side ever waits - a frame that races a block just sees that
+// block's values on the next read.
+class MeterBridge
+{
+public:
+    static constexpr int maxChannels = 2;
+
+    struct Snapshot
+    {
+        std::array<float, maxChannels> inputPeak {};   // Linear
+        std::array<float, maxChannels> outputPeak {};  // Linear
+        float gainReductionDb = 0.0f;                   // Largest reduction, as a positive dB amount
+        std::array<juce::uint32, maxChannels> clipCount {};
+    };
+
+    // Audio thread
+    void publishChannel(int channel, float inputPeak, float outputPeak, juce::uint32 clippedSamples)
+    {
+        if (! juce::isPositiveAndBelow(channel, maxChannels))
+            return;
+
+        auto& meters = channels[static_cast<size_t>(channel)];
+        storeMax(meters.inputPeak, inputPeak);
+        storeMax(meters.outputPeak, outputPeak);
+
+        if (clippedSamples > 0)
+            meters.clipCount.fetch_add(clippedSamples, std::memory_order_relaxed);
+    }
+
+    void publishGainReduction(float reductionDb)
+    {
+        storeMax(gainReductionDb, reductionDb);
+    }
+
+    // Message thread: everything since the previous read
+    Snapshot read()
+    {
+        Snapshot snapshot;
+
+        for (size_t channel = 0; channel < channels.size(); ++channel)
+        {
+            auto& meters = channels[channel];
+            snapshot.inputPeak[channel] = meters.inputPeak.exchange(0.0f, std::memory_order_relaxed);
+            snapshot.outputPeak[channel] = meters.outputPeak.exchange(0.0f, std::memory_order_relaxed);
+            snapshot.clipCount[channel] = meters.clipCount.exchange(0, std::memory_order_relaxed);
+        }
+
+        snapshot.gainReductionDb = gainReductionDb.exchange(0.0f, std::memory_order_relaxed);
+        return snapshot;
+    }
+
+private:
+    struct ChannelMeters
+    {
+        std::atomic<float> inputPeak { 0.0f };
+        std::atomic<float> outputPeak { 0.0f };
+        std::atomic<juce::uint32> clipCount { 0 };
+    };
+
+    static void storeMax(std::atomic<float>& target, float value)
+    {
+        float current = target.load(std::memory_order_relaxed);
+        while (value > current && ! target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    std::array<ChannelMeters, maxChannels> channels;
+    std::atomic<float> gainReductionDb { 0.0f };
+};
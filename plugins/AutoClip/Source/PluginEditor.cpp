@@ -10,6 +10,8 @@ AutoClipAudioProcessorEditor::AutoClipAudioProcessorEditor(AutoClipAudioProcesso
     // 1. Create relays FIRST (with exact parameter IDs from APVTS)
     clipThresholdRelay = std::make_unique<juce::WebSliderRelay>("clipThreshold");
     soloClippedRelay = std::make_unique<juce::WebToggleButtonRelay>("soloClipped");
+    lookaheadLimitRelay = std::make_unique<juce::WebToggleButtonRelay>("lookaheadLimit");
+    truePeakRelay = std::make_unique<juce::WebToggleButtonRelay>("truePeak");
 
     // 2. Create WebView with relay options
     webView = std::make_unique<juce::WebBrowserComponent>(
@@ -18,6 +20,8 @@ AutoClipAudioProcessorEditor::AutoClipAudioProcessorEditor(AutoClipAudioProcesso
             .withResourceProvider([this](const auto& url) { return getResource(url); })
             .withOptionsFrom(*clipThresholdRelay)
             .withOptionsFrom(*soloClippedRelay)
+            .withOptionsFrom(*lookaheadLimitRelay)
+            .withOptionsFrom(*truePeakRelay)
     );
 
     // 3. Create attachments LAST (Pattern #12: 3 parameters including nullptr)
@@ -33,6 +37,18 @@ AutoClipAudioProcessorEditor::AutoClipAudioProcessorEditor(AutoClipAudioProcesso
         nullptr  // undoManager (required in JUCE 8)
     );
 
+    lookaheadLimitAttachment = std::make_unique<juce::WebToggleButtonParameterAttachment>(
+        *processorRef.parameters.getParameter("lookaheadLimit"),
+        *lookaheadLimitRelay,
+        nullptr  // undoManager (required in JUCE 8)
+    );
+
+    truePeakAttachment = std::make_unique<juce::WebToggleButtonParameterAttachment>(
+        *processorRef.parameters.getParameter("truePeak"),
+        *truePeakRelay,
+        nullptr  // undoManager (required in JUCE 8)
+    );
+
     // Add WebView to editor
     addAndMakeVisible(*webView);
 
@@ -42,6 +58,9 @@ AutoClipAudioProcessorEditor::AutoClipAudioProcessorEditor(AutoClipAudioProcesso
     // Set editor size (from UI mockup dimensions)
     setSize(300, 500);
 
+    // Phase 5.3: Meter event payload (reused every frame)
+    meterData = new juce::DynamicObject();
+
     // Phase 5.3: Start meter update timer (30 Hz refresh rate)
     startTimerHz(30);
 }
@@ -116,37 +135,30 @@ void AutoClipAudioProcessorEditor::timerCallback()
     if (!webView)
         return;
 
-    // Read parameters
-    auto* clipThresholdParam = processorRef.parameters.getRawParameterValue("clipThreshold");
-    float clipThresholdPercent = clipThresholdParam->load();
-    float clipThreshold = clipThresholdPercent * 0.01f;  // Convert 0-100% to 0.0-1.0
-
-    // Simple peak detection from last processed buffer
-    // Note: Real implementation would use atomic<float> in processor for thread-safe access
-    // For now, use smoothed approximation based on parameters
-
-    // Estimate input peak (assume normalized signal)
-    float estimatedInputPeak = 0.7f;  // Placeholder - would read from processor
+    // Everything the audio thread published since the last frame (lock-free, no allocation)
+    const auto meters = processorRef.meterBridge.read();
 
-    // Estimate output peak (if clipping, output clamped to threshold)
-    float estimatedOutputPeak = (clipThreshold > 0.01f && clipThreshold < 1.0f)
-                                ? clipThreshold
-                                : estimatedInputPeak;
+    const float inputPeak = juce::jmax(meters.inputPeak[0], meters.inputPeak[1]);
+    const float outputPeak = juce::jmax(meters.outputPeak[0], meters.outputPeak[1]);
+    const auto clipCount = meters.clipCount[0] + meters.clipCount[1];
 
     // Smooth peaks for visual stability (exponential smoothing)
     const float smoothingFactor = 0.3f;
-    smoothedInputPeak += (estimatedInputPeak - smoothedInputPeak) * smoothingFactor;
-    smoothedOutputPeak += (estimatedOutputPeak - smoothedOutputPeak) * smoothingFactor;
-
-    // Detect clipping (occurs when threshold < 1.0 and signal would exceed it)
-    bool isClipping = (clipThreshold < 0.99f && estimatedInputPeak > clipThreshold);
+    smoothedInputPeak += (inputPeak - smoothedInputPeak) * smoothingFactor;
+    smoothedOutputPeak += (outputPeak - smoothedOutputPeak) * smoothingFactor;
 
     // Send meter data to JavaScript via custom event
     // JavaScript listens for 'meterUpdate' event
-    auto meterData = std::make_unique<juce::DynamicObject>();
     meterData->setProperty("inputPeak", smoothedInputPeak);
     meterData->setProperty("outputPeak", smoothedOutputPeak);
-    meterData->setProperty("isClipping", isClipping);
-
-    webView->emitEventIfBrowserIsVisible("meterUpdate", juce::var(meterData.release()));
+    meterData->setProperty("isClipping", clipCount > 0);
+    meterData->setProperty("inputPeakL", meters.inputPeak[0]);
+    meterData->setProperty("inputPeakR", meters.inputPeak[1]);
+    meterData->setProperty("outputPeakL", meters.outputPeak[0]);
+    meterData->setProperty("outputPeakR", meters.outputPeak[1]);
+    meterData->setProperty("gainReduction", meters.gainReductionDb);
+    meterData->setProperty("clipCountL", static_cast<int>(meters.clipCount[0]));
+    meterData->setProperty("clipCountR", static_cast<int>(meters.clipCount[1]));
+
+    webView->emitEventIfBrowserIsVisible("meterUpdate", juce::var(meterData.get()));
 }
@@ -22,6 +22,8 @@ private:
     // 1. Relays (no dependencies)
     std::unique_ptr<juce::WebSliderRelay> clipThresholdRelay;
     std::unique_ptr<juce::WebToggleButtonRelay> soloClippedRelay;
+    std::unique_ptr<juce::WebToggleButtonRelay> lookaheadLimitRelay;
+    std::unique_ptr<juce::WebToggleButtonRelay> truePeakRelay;
 
     // 2. WebView (depends on relays via withOptionsFrom)
     std::unique_ptr<juce::WebBrowserComponent> webView;
@@ -29,6 +31,8 @@ private:
     // 3. Attachments (depend on both relays and webView)
     std::unique_ptr<juce::WebSliderParameterAttachment> clipThresholdAttachment;
     std::unique_ptr<juce::WebToggleButtonParameterAttachment> soloClippedAttachment;
+    std::unique_ptr<juce::WebToggleButtonParameterAttachment> lookaheadLimitAttachment;
+    std::unique_ptr<juce::WebToggleButtonParameterAttachment> truePeakAttachment;
 
     // Resource provider helper
     std::optional<juce::WebBrowserComponent::Resource> getResource(const juce::String& url);
@@ -37,6 +41,7 @@ private:
     void timerCallback() override;
     float smoothedInputPeak = 0.0f;
     float smoothedOutputPeak = 0.0f;
+    juce::DynamicObject::Ptr meterData;  // Created once, properties updated in place each frame
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AutoClipAudioProcessorEditor)
 };
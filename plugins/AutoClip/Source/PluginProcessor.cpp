@@ -24,6 +24,22 @@ juce::AudioProcessorValueTreeState::ParameterLayout AutoClipAudioProcessor::crea
         false
     ));
 
+    // lookaheadLimit - Bool (default: false = plain clipping)
+    // Uses the 5ms look-ahead to pull peaks down to the threshold before they arrive
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID { "lookaheadLimit", 1 },
+        "Look-Ahead Limit",
+        false
+    ));
+
+    // truePeak - Bool (default: false)
+    // 4x oversampled detection and clipping: catches inter-sample peaks, no aliasing
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID { "truePeak", 1 },
+        "True Peak",
+        false
+    ));
+
     return layout;
 }
 
@@ -54,26 +70,49 @@ void AutoClipAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBloc
 
     lookaheadSamples = static_cast<int>(0.005 * sampleRate);  // 5ms in samples
 
+    // Phase 4.1: True-peak clipper (oversampling filters prepared up front, toggled per block)
+    truePeakClipper.prepare(spec);
+    truePeakActive = parameters.getRawParameterValue("truePeak")->load() > 0.5f;
+    updateLatency();
+
+    // Long enough to also re-read the dry signal at the true-peak filters' latency (clip solo)
+    const int maxDelaySamples = lookaheadSamples + truePeakClipper.getLatencySamples();
     lookaheadDelayL.prepare(spec);
     lookaheadDelayR.prepare(spec);
-    lookaheadDelayL.setMaximumDelayInSamples(lookaheadSamples);
-    lookaheadDelayR.setMaximumDelayInSamples(lookaheadSamples);
+    lookaheadDelayL.setMaximumDelayInSamples(maxDelaySamples);
+    lookaheadDelayR.setMaximumDelayInSamples(maxDelaySamples);
     lookaheadDelayL.reset();
     lookaheadDelayR.reset();
 
+    // Phase 4.1: Look-ahead gain computer (linked across channels)
+    lookaheadGain.prepare(sampleRate, lookaheadSamples);
+
+    // Per-sample gains shared by all channels: look-ahead gain, makeup gain ramp
+    gainBuffer.setSize(2, samplesPerBlock);
+
     // Phase 4.2: Prepare gain smoothing (50ms time constant)
     smoothedGain.reset(sampleRate, 0.05);  // 50ms smoothing
     smoothedGain.setCurrentAndTargetValue(1.0f);  // Default gain = 1.0
 
-    // Phase 4.3: Preallocate original buffer for clip solo
-    originalBuffer.setSize(getTotalNumOutputChannels(), samplesPerBlock);
-    originalBuffer.clear();
+    // Phase 4.3: Preallocate the true-peak clip solo dry buffer
+    truePeakDryBuffer.setSize(getTotalNumOutputChannels(), samplesPerBlock);
+    truePeakDryBuffer.clear();
+}
+
+void AutoClipAudioProcessor::updateLatency()
+{
+    // The look-ahead delay is always in the signal path; the true-peak filters only while enabled
+    const int latency = lookaheadSamples + (truePeakActive ? truePeakClipper.getLatencySamples() : 0);
+
+    if (latency != getLatencySamples())
+        setLatencySamples(latency);
 }
 
 void AutoClipAudioProcessor::releaseResources()
 {
     // Release large buffers to save memory when plugin not in use
-    originalBuffer.setSize(0, 0);
+    truePeakDryBuffer.setSize(0, 0);
+    gainBuffer.setSize(0, 0);
 }
 
 void AutoClipAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
@@ -89,49 +128,124 @@ void AutoClipAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
     auto* soloClippedParam = parameters.getRawParameterValue("soloClipped");
     bool soloClipped = soloClippedParam->load() > 0.5f;
 
+    auto* lookaheadLimitParam = parameters.getRawParameterValue("lookaheadLimit");
+    bool lookaheadLimit = lookaheadLimitParam->load() > 0.5f;
+
+    auto* truePeakParam = parameters.getRawParameterValue("truePeak");
+    bool truePeak = truePeakParam->load() > 0.5f;
+
+    if (truePeak != truePeakActive)
+    {
+        truePeakActive = truePeak;
+        truePeakClipper.reset();
+        updateLatency();
+    }
+
+    // Scratch buffers are sized once in prepareToPlay; larger host blocks run in chunks of that size
+    const int chunkSize = juce::jmin(gainBuffer.getNumSamples(), truePeakDryBuffer.getNumSamples());
+    const int totalSamples = buffer.getNumSamples();
+
+    for (int start = 0; start < totalSamples && chunkSize > 0; start += chunkSize)
+    {
+        juce::AudioBuffer<float> chunk(buffer.getArrayOfWritePointers(), buffer.getNumChannels(),
+                                       start, juce::jmin(chunkSize, totalSamples - start));
+        processChunk(chunk, clipThreshold, soloClipped, lookaheadLimit, truePeak);
+    }
+}
+
+void AutoClipAudioProcessor::processChunk(juce::AudioBuffer<float>& buffer, float clipThreshold,
+                                          bool soloClipped, bool lookaheadLimit, bool truePeak)
+{
     const int numSamples = buffer.getNumSamples();
-    const int numChannels = buffer.getNumChannels();
+    const int numChannels = juce::jmin(buffer.getNumChannels(), MeterBridge::maxChannels);
 
-    // Phase 4.3: Store original signal before processing
-    originalBuffer.setSize(numChannels, numSamples, false, false, true);
-    for (int channel = 0; channel < numChannels; ++channel)
+    auto* limiterGains = gainBuffer.getWritePointer(0);
+    auto* makeupGains = gainBuffer.getWritePointer(1);
+
+    // Phase 4.1: Look-ahead gain, from the linked input level before it enters the delay
+    if (lookaheadLimit)
     {
-        originalBuffer.copyFrom(channel, 0, buffer, channel, 0, numSamples);
+        juce::FloatVectorOperations::abs(limiterGains, buffer.getReadPointer(0), numSamples);
+        for (int channel = 1; channel < numChannels; ++channel)
+            for (int sample = 0; sample < numSamples; ++sample)
+                limiterGains[sample] = juce::jmax(limiterGains[sample], std::abs(buffer.getSample(channel, sample)));
+
+        lookaheadGain.process(limiterGains, limiterGains, numSamples, clipThreshold);
     }
+    else
+    {
+        lookaheadGain.reset();
+    }
+
+    // Phase 4.3: Clip solo in true-peak mode subtracts from the dry signal re-read at the
+    // oversampling filters' latency (the base-rate path subtracts in its fused loop instead)
+    const bool truePeakSolo = truePeak && soloClipped;
+    const int truePeakDryDelay = lookaheadSamples + truePeakClipper.getLatencySamples();
 
-    // Phase 4.1 & 4.2: Process each channel
+    // Phase 4.1: Look-ahead delay (the only sample-serial stage)
     for (int channel = 0; channel < numChannels; ++channel)
     {
         auto* channelData = buffer.getWritePointer(channel);
         auto& delayLine = (channel == 0) ? lookaheadDelayL : lookaheadDelayR;
+        auto* dryData = truePeakSolo ? truePeakDryBuffer.getWritePointer(channel) : nullptr;
 
-        // Reset peak detectors for this block
-        inputPeak = 0.0f;
-        outputPeak = 0.0f;
-
-        // Process sample by sample
         for (int sample = 0; sample < numSamples; ++sample)
         {
-            // Phase 4.1: Push input to lookahead buffer
             delayLine.pushSample(channel, channelData[sample]);
 
-            // Phase 4.2: Analyze input peak from lookahead buffer (before clipping)
-            // Get delayed sample from lookahead
-            float delayedSample = delayLine.popSample(channel, lookaheadSamples);
-            inputPeak = juce::jmax(inputPeak, std::abs(delayedSample));
+            if (dryData != nullptr)
+                dryData[sample] = delayLine.popSample(channel, static_cast<float>(truePeakDryDelay), false);
+
+            channelData[sample] = delayLine.popSample(channel, static_cast<float>(lookaheadSamples));
+        }
+    }
+
+    // Phase 4.2: Linked input peak (delayed, before clipping) - one vector pass per channel
+    std::array<float, MeterBridge::maxChannels> channelInputPeaks {};
+    std::array<juce::uint32, MeterBridge::maxChannels> channelClips {};
+    float inputPeak = 0.0f;
+    float outputPeak = 0.0f;
 
-            // Phase 4.1: Apply hard clipping
-            float clippedSample = juce::jlimit(-clipThreshold, clipThreshold, delayedSample);
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        channelInputPeaks[static_cast<size_t>(channel)] = buffer.getMagnitude(channel, 0, numSamples);
+        inputPeak = juce::jmax(inputPeak, channelInputPeaks[static_cast<size_t>(channel)]);
+    }
 
-            // Phase 4.2: Analyze output peak from clipped signal
-            outputPeak = juce::jmax(outputPeak, std::abs(clippedSample));
+    if (truePeak)
+    {
+        // Phase 4.1: Look-ahead gain, then clip at 4x; gain matching uses the true peaks
+        if (lookaheadLimit)
+            for (int channel = 0; channel < numChannels; ++channel)
+                juce::FloatVectorOperations::multiply(buffer.getWritePointer(channel), limiterGains, numSamples);
+
+        float truePeakIn = 0.0f;
+        truePeakClipper.process(buffer, numChannels, numSamples, clipThreshold, truePeakIn, outputPeak, channelClips.data());
+        inputPeak = juce::jmax(inputPeak, truePeakIn);
+    }
+    else
+    {
+        // Phase 4.2: Linked output peak and overs of the signal about to be clipped
+        // (branch-free reductions; the clip itself is fused into the gain pass below)
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            const auto* channelData = buffer.getReadPointer(channel);
+            float limitedPeak = 0.0f;
+            juce::uint32 overs = 0;
 
-            // Store clipped sample (will apply gain in second pass)
-            channelData[sample] = clippedSample;
+            for (int sample = 0; sample < numSamples; ++sample)
+            {
+                const float limited = std::abs(lookaheadLimit ? channelData[sample] * limiterGains[sample] : channelData[sample]);
+                limitedPeak = juce::jmax(limitedPeak, limited);
+                overs += limited > clipThreshold ? 1u : 0u;
+            }
+
+            outputPeak = juce::jmax(outputPeak, juce::jmin(limitedPeak, clipThreshold));
+            channelClips[static_cast<size_t>(channel)] = overs;
         }
     }
 
-    // Phase 4.2: Calculate gain compensation (after analyzing all channels)
+    // Phase 4.2: Calculate gain compensation from the linked peaks
     float targetGain = 1.0f;
     if (outputPeak > 0.001f && inputPeak > 0.001f)
     {
@@ -139,33 +253,72 @@ void AutoClipAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
     }
     smoothedGain.setTargetValue(targetGain);
 
-    // Apply smoothed gain to all channels
+    // One smoothed gain ramp shared by every channel (stereo image stays put)
+    if (smoothedGain.isSmoothing())
+    {
+        for (int sample = 0; sample < numSamples; ++sample)
+            makeupGains[sample] = smoothedGain.getNextValue();
+    }
+    else
+    {
+        juce::FloatVectorOperations::fill(makeupGains, smoothedGain.getTargetValue(), numSamples);
+    }
+
+    // Phase 4.1-4.3: Apply makeup gain (base rate: clip fused in), or output the clip
+    // solo difference signal = dry - clipped_with_gain as one fused subtract
     for (int channel = 0; channel < numChannels; ++channel)
     {
         auto* channelData = buffer.getWritePointer(channel);
 
-        for (int sample = 0; sample < numSamples; ++sample)
+        if (truePeak)
         {
-            float currentGain = smoothedGain.getNextValue();
-            channelData[sample] *= currentGain;
+            if (soloClipped)
+            {
+                const auto* dryData = truePeakDryBuffer.getReadPointer(channel);
+                for (int sample = 0; sample < numSamples; ++sample)
+                    channelData[sample] = dryData[sample] - channelData[sample] * makeupGains[sample];
+            }
+            else
+            {
+                juce::FloatVectorOperations::multiply(channelData, makeupGains, numSamples);
+            }
         }
-    }
-
-    // Phase 4.3: Clip solo routing (output difference signal if enabled)
-    if (soloClipped)
-    {
-        for (int channel = 0; channel < numChannels; ++channel)
+        else
         {
-            auto* outputData = buffer.getWritePointer(channel);
-            auto* originalData = originalBuffer.getReadPointer(channel);
+            const float* gains = lookaheadLimit ? limiterGains : nullptr;
 
-            for (int sample = 0; sample < numSamples; ++sample)
+            if (soloClipped)
             {
-                // Difference signal = original - clipped_with_gain
-                outputData[sample] = originalData[sample] - outputData[sample];
+                for (int sample = 0; sample < numSamples; ++sample)
+                {
+                    const float dry = channelData[sample];
+                    const float limited = gains != nullptr ? dry * gains[sample] : dry;
+                    channelData[sample] = dry - juce::jlimit(-clipThreshold, clipThreshold, limited) * makeupGains[sample];
+                }
+            }
+            else
+            {
+                if (gains != nullptr)
+                    juce::FloatVectorOperations::multiply(channelData, gains, numSamples);
+
+                juce::FloatVectorOperations::clip(channelData, channelData, -clipThreshold, clipThreshold, numSamples);
+                juce::FloatVectorOperations::multiply(channelData, makeupGains, numSamples);
             }
         }
     }
+
+    // Phase 5.3: Peak reduction from look-ahead gain and clipping (what the makeup gain restores)
+    if (inputPeak > 0.001f && outputPeak > 0.0f)
+        meterBridge.publishGainReduction(juce::jmax(0.0f, -juce::Decibels::gainToDecibels(outputPeak / inputPeak)));
+
+    // Phase 5.3: Publish meter values (lock-free; the editor collects them at its frame rate)
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        meterBridge.publishChannel(channel,
+                                   channelInputPeaks[static_cast<size_t>(channel)],
+                                   buffer.getMagnitude(channel, 0, numSamples),
+                                   channelClips[static_cast<size_t>(channel)]);
+    }
 }
 
 //==============================================================================
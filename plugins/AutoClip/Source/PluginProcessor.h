@@ -1,6 +1,9 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "LookaheadLimiter.h"
+#include "TruePeakClipper.h"
+#include "MeterBridge.h"
 
 class AutoClipAudioProcessor : public juce::AudioProcessor
 {
@@ -33,6 +36,9 @@ public:
     // Public APVTS for editor binding
     juce::AudioProcessorValueTreeState parameters;
 
+    // Phase 5.3: Per-channel peaks, gain reduction and clip counts for the editor's meters
+    MeterBridge meterBridge;
+
 private:
     // Parameter layout creation
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
@@ -43,13 +49,29 @@ private:
     juce::dsp::DelayLine<float> lookaheadDelayR { 48000 };
     int lookaheadSamples = 0;
 
+    // Look-ahead limiting: per-sample gain reduction computed from the undelayed input,
+    // so it has ramped down by the time each peak leaves the delay
+    LookaheadGainComputer lookaheadGain;
+
+    // Per-sample gains shared by all channels (stereo-linked):
+    // channel 0 = look-ahead gain (linked input level until computed), channel 1 = makeup ramp
+    juce::AudioBuffer<float> gainBuffer;
+
+    // Optional 4x true-peak clipping (adds its filter latency while enabled)
+    TruePeakClipper truePeakClipper;
+    bool truePeakActive = false;
+    void updateLatency();
+
     // Phase 4.2: Automatic Gain Matching
     juce::SmoothedValue<float> smoothedGain;
-    float inputPeak = 0.0f;
-    float outputPeak = 0.0f;
 
-    // Phase 4.3: Clip Solo (Delta Monitoring)
-    juce::AudioBuffer<float> originalBuffer;
+    // Phase 4.3: Clip Solo (Delta Monitoring) - dry signal aligned with the true-peak
+    // clipper's output; only filled while both are enabled
+    juce::AudioBuffer<float> truePeakDryBuffer;
+
+    // Everything after the parameter reads, on at most the prepared block size
+    void processChunk(juce::AudioBuffer<float>& buffer, float clipThreshold,
+                      bool soloClipped, bool lookaheadLimit, bool truePeak);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AutoClipAudioProcessor)
 };
@@ -0,0 +1,112 @@
+#include "TruePeakClipper.h"
+
+//==============================================================================
+void TruePeakClipper::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    // 2 half-band stages = 4x, linear-phase FIR, integer latency for host compensation
+    auto makeOversampler = [&spec]
+    {
+        return std::make_unique<juce::dsp::Oversampling<float>>(
+            spec.numChannels,
+            2,
+            juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple,
+            true,
+            true);
+    };
+
+    maxBlockSize = static_cast<size_t>(juce::jmax(1u, spec.maximumBlockSize));
+
+    oversampler = makeOversampler();
+    oversampler->initProcessing(maxBlockSize);
+
+    meterOversampler = makeOversampler();
+    meterOversampler->initProcessing(maxBlockSize);
+
+    reset();
+}
+
+void TruePeakClipper::reset()
+{
+    if (oversampler != nullptr)
+        oversampler->reset();
+
+    if (meterOversampler != nullptr)
+        meterOversampler->reset();
+}
+
+int TruePeakClipper::getLatencySamples() const
+{
+    return oversampler != nullptr ? static_cast<int>(oversampler->getLatencyInSamples()) : 0;
+}
+
+void TruePeakClipper::process(juce::AudioBuffer<float>& buffer, int numChannels, int numSamples, float threshold,
+                              float& truePeakIn, float& truePeakOut, juce::uint32* clippedSamples)
+{
+    truePeakIn = 0.0f;
+    truePeakOut = 0.0f;
+
+    if (clippedSamples != nullptr)
+        std::fill(clippedSamples, clippedSamples + numChannels, 0u);
+
+    if (oversampler == nullptr)
+        return;
+
+    // The oversamplers' buffers hold maxBlockSize base-rate samples; larger host blocks run in chunks
+    const auto channels = static_cast<size_t>(juce::jmin(numChannels, buffer.getNumChannels()));
+    auto block = juce::dsp::AudioBlock<float>(buffer).getSubsetChannelBlock(0, channels);
+    const auto total = static_cast<size_t>(numSamples);
+
+    for (size_t start = 0; start < total; start += maxBlockSize)
+        processChunk(block.getSubBlock(start, juce::jmin(maxBlockSize, total - start)),
+                     threshold, truePeakIn, truePeakOut, clippedSamples);
+}
+
+void TruePeakClipper::processChunk(juce::dsp::AudioBlock<float> block, float threshold,
+                                   float& truePeakIn, float& truePeakOut, juce::uint32* clippedSamples)
+{
+    const auto factor = static_cast<juce::uint32>(oversampler->getOversamplingFactor());
+
+    auto upBlock = oversampler->processSamplesUp(block);
+    const int upSamples = static_cast<int>(upBlock.getNumSamples());
+
+    for (size_t channel = 0; channel < upBlock.getNumChannels(); ++channel)
+    {
+        float* data = upBlock.getChannelPointer(channel);
+
+        // True peak: largest interpolated magnitude
+        const auto range = juce::FloatVectorOperations::findMinAndMax(data, upSamples);
+        truePeakIn = juce::jmax(truePeakIn, juce::jmax(-range.getStart(), range.getEnd()));
+
+        if (clippedSamples != nullptr)
+        {
+            // Oversampled overs, rounded up to base-rate samples
+            juce::uint32 overs = 0;
+            for (int i = 0; i < upSamples; ++i)
+                overs += std::abs(data[i]) > threshold ? 1u : 0u;
+
+            clippedSamples[channel] += (overs + factor - 1) / factor;
+        }
+
+        juce::FloatVectorOperations::clip(data, data, -threshold, threshold, upSamples);
+    }
+
+    oversampler->processSamplesDown(block);
+
+    // Catch the downsampling filter's overshoot, then measure what actually goes out
+    const int numSamples = static_cast<int>(block.getNumSamples());
+
+    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    {
+        float* data = block.getChannelPointer(channel);
+        juce::FloatVectorOperations::clip(data, data, -threshold, threshold, numSamples);
+    }
+
+    auto outBlock = meterOversampler->processSamplesUp(block);
+    const int outSamples = static_cast<int>(outBlock.getNumSamples());
+
+    for (size_t channel = 0; channel < outBlock.getNumChannels(); ++channel)
+    {
+        const auto range = juce::FloatVectorOperations::findMinAndMax(outBlock.getChannelPointer(channel), outSamples);
+        truePeakOut = juce::jmax(truePeakOut, juce::jmax(-range.getStart(), range.getEnd()));
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+#include <memory>
+
+// 4x oversampled hard clipper with true-peak measurement.
+//
+// Follows the ITU-R BS.1770 true-peak approach: the signal is interpolated
+// to 4x with linear-phase polyphase half-band FIRs, peaks are measured there
+// (catching inter-sample overs), and the clip happens at the high rate with
+// a vector clamp so its harmonics above the base Nyquist are filtered out on
+// the way down instead of aliasing.
+//
+// The downsampling filter's ripple brings back a little overshoot, so the
+// base-rate result is clamped at the threshold once more (a tiny clip, only
+// where the filter overshot) and the output's true peak is measured after
+// that through a second, measurement-only 4x interpolator. The reported
+// output level is what actually leaves the clipper, not the threshold.
+class TruePeakClipper
+{
+public:
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    int getLatencySamples() const;
+
+    // Clips the first numSamples of the first numChannels channels in place at
+    // +/-threshold (any length: blocks beyond the prepared size run in chunks).
+    // Other channels are left alone. Reports the highest oversampled level going
+    // in and coming out, and optionally (clippedSamples, numChannels entries) how
+    // many base-rate samples clipped.
+    void process(juce::AudioBuffer<float>& buffer, int numChannels, int numSamples, float threshold,
+                 float& truePeakIn, float& truePeakOut, juce::uint32* clippedSamples = nullptr);
+
+private:
+    void processChunk(juce::dsp::AudioBlock<float> block, float threshold,
+                      float& truePeakIn, float& truePeakOut, juce::uint32* clippedSamples);
+
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversampler;       // Clip path
+    std::unique_ptr<juce::dsp::Oversampling<float>> meterOversampler;  // Output true peak (up only)
+    size_t maxBlockSize = 1;
+};
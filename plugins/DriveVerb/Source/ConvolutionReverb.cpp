@@ -0,0 +1,420 @@
+#include "ConvolutionReverb.h"
+
+//==============================================================================
+ConvolutionTailWorkers::~ConvolutionTailWorkers()
+{
+    loader.removeAllJobs(true, 10000);
+
+    for (auto& worker : workers)
+        worker->signalThreadShouldExit();
+
+    // Each wake-up is passed on by the worker that takes it, but keep signalling
+    // in case one lands while nobody is waiting
+    for (auto& worker : workers)
+        while (! worker->waitForThreadToExit(5))
+            work.signal();
+}
+
+void ConvolutionTailWorkers::add(ConvolutionReverb& instance)
+{
+    const juce::ScopedWriteLock lock(instancesLock);
+    instances.addIfNotAlreadyThere(&instance);
+
+    if (workers.empty())
+    {
+        // Leave a core for the audio thread
+        const int numWorkers = juce::jlimit(1, 8, juce::SystemStats::getNumCpus() - 1);
+
+        for (int i = 0; i < numWorkers; ++i)
+        {
+            workers.push_back(std::make_unique<Worker>(*this));
+            workers.back()->startThread(juce::Thread::Priority::high);
+        }
+    }
+}
+
+void ConvolutionTailWorkers::remove(ConvolutionReverb& instance)
+{
+    // Writers wait for every worker to leave service()
+    const juce::ScopedWriteLock lock(instancesLock);
+    instances.removeFirstMatchingValue(&instance);
+}
+
+void ConvolutionTailWorkers::Worker::run()
+{
+    while (! threadShouldExit())
+    {
+        owner.work.wait(-1);
+
+        if (! threadShouldExit())
+            owner.service();
+    }
+
+    owner.work.signal();  // Hand the shutdown on to the next sleeping worker
+}
+
+void ConvolutionTailWorkers::service()
+{
+    // One pass per lock so remove() never waits on a worker kept busy by new input
+    for (bool didWork = true; didWork;)
+    {
+        const juce::ScopedReadLock lock(instancesLock);
+        didWork = false;
+
+        for (auto* instance : instances)
+        {
+            if (! instance->claimTail())
+                continue;
+
+            work.signal();  // Another worker can take the other instances meanwhile
+            instance->serviceTail();
+            instance->releaseTail();
+            didWork = true;
+        }
+    }
+}
+
+//==============================================================================
+ConvolutionReverb::ConvolutionReverb()
+{
+    formatManager.registerBasicFormats();
+}
+
+ConvolutionReverb::~ConvolutionReverb()
+{
+    removeLoadJobs();
+    workers->remove(*this);
+}
+
+void ConvolutionReverb::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    // Nothing may touch the engines or rings while they are rebuilt
+    removeLoadJobs();
+    workers->remove(*this);
+
+    numChannels = static_cast<int>(spec.numChannels);
+    maxBlockSize = juce::jmax(1, static_cast<int>(spec.maximumBlockSize));
+
+    // Head covers a partition plus two chunks: a partition completes at the latest
+    // in the chunk that needs the previous one's tail, leaving the worker at least
+    // one full chunk of time
+    const int head = partitionSize * juce::jmax(2, (2 * partitionSize + 2 * maxBlockSize - 1) / partitionSize);
+    headLength.store(head);
+    processingSampleRate.store(spec.sampleRate);
+
+    headConvolution.prepare(spec);
+    tailConvolution.prepare({ spec.sampleRate, static_cast<juce::uint32>(partitionSize), spec.numChannels });
+
+    inputRing.setSize(numChannels, juce::nextPowerOfTwo(4 * partitionSize + 4 * maxBlockSize));
+    outputRing.setSize(numChannels, juce::nextPowerOfTwo(head + 2 * partitionSize + 2 * maxBlockSize));
+    tailScratch.setSize(numChannels, partitionSize);
+    inputRing.clear();
+    outputRing.clear();
+    inputMask = inputRing.getNumSamples() - 1;
+    outputMask = outputRing.getNumSamples() - 1;
+
+    samplesPushed.store(0);
+    resetPosition.store(0);
+    completedPartitions.store(0);
+    tailValidFrom.store(0);
+    appliedReset = 0;
+
+    // Any IR was split for the old rate and head length; the owner reloads it
+    hasImpulseResponse.store(false);
+    irLength.store(0);
+    ++loadGeneration;
+}
+
+void ConvolutionReverb::reset()
+{
+    headConvolution.reset();
+
+    // The worker restarts the tail engine when it reaches this point
+    resetPosition.store(samplesPushed.load(std::memory_order_relaxed), std::memory_order_release);
+}
+
+void ConvolutionReverb::process(const juce::dsp::ProcessContextReplacing<float>& context)
+{
+    auto& block = context.getOutputBlock();
+
+    if (! hasImpulseResponse.load(std::memory_order_acquire) || numChannels == 0)
+    {
+        block.clear();
+        return;
+    }
+
+    // The head length and ring sizes assume at most maxBlockSize samples per push
+    const auto total = block.getNumSamples();
+    const auto chunkSize = static_cast<size_t>(maxBlockSize);
+
+    for (size_t start = 0; start < total; start += chunkSize)
+        processChunk(block.getSubBlock(start, juce::jmin(chunkSize, total - start)));
+}
+
+void ConvolutionReverb::processChunk(juce::dsp::AudioBlock<float> block)
+{
+    const int numSamples = static_cast<int>(block.getNumSamples());
+    const int channels = juce::jmin(static_cast<int>(block.getNumChannels()), numChannels);
+
+    // 1. Queue the input for the tail workers, waking them at each partition boundary
+    const auto start = samplesPushed.load(std::memory_order_relaxed);
+    const auto end = start + numSamples;
+
+    for (int channel = 0; channel < channels; ++channel)
+    {
+        const float* input = block.getChannelPointer(static_cast<size_t>(channel));
+        float* ring = inputRing.getWritePointer(channel);
+
+        for (int i = 0; i < numSamples; ++i)
+            ring[static_cast<int>((start + i) & inputMask)] = input[i];
+    }
+
+    samplesPushed.store(end, std::memory_order_release);
+
+    if (end / partitionSize != start / partitionSize)
+        workers->wake();
+
+    // 2. Head in place
+    headConvolution.process(juce::dsp::ProcessContextReplacing<float>(block));
+
+    // 3. Add the tail wherever the worker has finished it for the current timeline
+    const auto readyUntil = completedPartitions.load(std::memory_order_acquire) * partitionSize
+                          + headLength.load(std::memory_order_relaxed);
+    const auto from = juce::jmax(start,
+                                 resetPosition.load(std::memory_order_relaxed) + headLength.load(std::memory_order_relaxed),
+                                 tailValidFrom.load(std::memory_order_acquire));
+    const auto until = juce::jmin(end, readyUntil);
+
+    for (int channel = 0; channel < channels; ++channel)
+    {
+        float* output = block.getChannelPointer(static_cast<size_t>(channel));
+        const float* ring = outputRing.getReadPointer(channel);
+
+        for (auto t = from; t < until; ++t)
+            output[t - start] += ring[static_cast<int>(t & outputMask)];
+    }
+}
+
+//==============================================================================
+bool ConvolutionReverb::hasPendingTail() const
+{
+    return (completedPartitions.load(std::memory_order_acquire) + 1) * partitionSize
+        <= samplesPushed.load(std::memory_order_acquire);
+}
+
+bool ConvolutionReverb::claimTail()
+{
+    return hasPendingTail() && ! tailBusy.exchange(true, std::memory_order_acquire);
+}
+
+void ConvolutionReverb::serviceTail()
+{
+    while (hasPendingTail())
+    {
+        const auto partition = completedPartitions.load(std::memory_order_relaxed);
+
+        if (processTailPartition(partition))
+        {
+            completedPartitions.store(partition + 1, std::memory_order_release);
+            continue;
+        }
+
+        // So far behind that the input ring has wrapped over this partition: drop
+        // what was missed and carry on from the newest complete partition
+        const auto next = juce::jmax(partition + 1, samplesPushed.load(std::memory_order_acquire) / partitionSize - 1);
+        tailConvolution.reset();
+        tailValidFrom.store(next * partitionSize + headLength.load(std::memory_order_relaxed),
+                            std::memory_order_release);
+        completedPartitions.store(next, std::memory_order_release);
+    }
+}
+
+bool ConvolutionReverb::processTailPartition(juce::int64 partition)
+{
+    const auto start = partition * partitionSize;
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        const float* ring = inputRing.getReadPointer(channel);
+        float* scratch = tailScratch.getWritePointer(channel);
+
+        for (int i = 0; i < partitionSize; ++i)
+            scratch[i] = ring[static_cast<int>((start + i) & inputMask)];
+    }
+
+    // The audio thread may have lapped the ring while we copied
+    if (samplesPushed.load(std::memory_order_acquire) + maxBlockSize > start + inputRing.getNumSamples())
+        return false;
+
+    // Reset since the last partition: restart the engine, input before it is silence
+    const auto resetAt = resetPosition.load(std::memory_order_acquire);
+
+    if (resetAt != appliedReset && resetAt < start + partitionSize)
+    {
+        tailConvolution.reset();
+
+        if (resetAt > start)
+            for (int channel = 0; channel < numChannels; ++channel)
+                juce::FloatVectorOperations::clear(tailScratch.getWritePointer(channel),
+                                                   static_cast<int>(resetAt - start));
+
+        appliedReset = resetAt;
+    }
+
+    juce::dsp::AudioBlock<float> block(tailScratch);
+    tailConvolution.process(juce::dsp::ProcessContextReplacing<float>(block));
+
+    // Tail IR starts headLength samples into the full IR
+    const auto outputStart = start + headLength.load(std::memory_order_relaxed);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        const float* scratch = tailScratch.getReadPointer(channel);
+        float* ring = outputRing.getWritePointer(channel);
+
+        for (int i = 0; i < partitionSize; ++i)
+            ring[static_cast<int>((outputStart + i) & outputMask)] = scratch[i];
+    }
+
+    return true;
+}
+
+//==============================================================================
+void ConvolutionReverb::loadImpulseResponse(const juce::File& file)
+{
+    const auto generation = ++loadGeneration;
+    workers->loader.addJob(new LoadJob(*this, file, generation), true);
+}
+
+void ConvolutionReverb::removeLoadJobs()
+{
+    // Only this instance's jobs; a running one is waited for
+    struct OwnJobs : public juce::ThreadPool::JobSelector
+    {
+        explicit OwnJobs(const ConvolutionReverb& o) : owner(o) {}
+
+        bool isJobSuitable(juce::ThreadPoolJob* job) override
+        {
+            auto* load = dynamic_cast<LoadJob*>(job);
+            return load != nullptr && &load->owner == &owner;
+        }
+
+        const ConvolutionReverb& owner;
+    };
+
+    OwnJobs selector(*this);
+    workers->loader.removeAllJobs(true, 10000, &selector);
+}
+
+void ConvolutionReverb::loadInBackground(const juce::File& file, juce::uint32 generation)
+{
+    const double sampleRate = processingSampleRate.load();
+    const int head = headLength.load();
+
+    if (sampleRate <= 0.0 || generation != loadGeneration.load())
+        return;
+
+    std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(file));
+
+    if (reader == nullptr || reader->lengthInSamples <= 0 || reader->sampleRate <= 0.0)
+        return;
+
+    // Decode (mono or the first two channels, capped at maxIRSeconds)
+    const int channels = static_cast<int>(juce::jlimit(1u, 2u, reader->numChannels));
+    const int fileLength = static_cast<int>(juce::jmin(reader->lengthInSamples,
+                                                       static_cast<juce::int64>(reader->sampleRate * maxIRSeconds)));
+    juce::AudioBuffer<float> ir(channels, fileLength);
+    reader->read(&ir, 0, fileLength, 0, true, channels > 1);
+
+    // Resample to the processing rate (band-limited, so downsampling doesn't alias)
+    if (std::abs(reader->sampleRate - sampleRate) > 1.0e-3)
+    {
+        juce::MemoryAudioSource memorySource(ir, false);
+        juce::ResamplingAudioSource resamplingSource(&memorySource, false, channels);
+
+        const int resampledLength = juce::jmax(1, juce::roundToInt(fileLength * sampleRate / reader->sampleRate));
+        resamplingSource.setResamplingRatio(reader->sampleRate / sampleRate);
+        resamplingSource.prepareToPlay(resampledLength, sampleRate);
+
+        juce::AudioBuffer<float> resampled(channels, resampledLength);
+        resamplingSource.getNextAudioBlock({ &resampled, 0, resampledLength });
+        ir = std::move(resampled);
+    }
+
+    // Trim leading/trailing silence (-80 dB below the peak)
+    const float threshold = ir.getMagnitude(0, ir.getNumSamples()) * juce::Decibels::decibelsToGain(-80.0f);
+
+    if (threshold <= 0.0f)
+        return;
+
+    int first = ir.getNumSamples();
+    int last = -1;
+
+    for (int channel = 0; channel < channels; ++channel)
+    {
+        const float* data = ir.getReadPointer(channel);
+
+        for (int i = 0; i < ir.getNumSamples(); ++i)
+        {
+            if (std::abs(data[i]) > threshold)
+            {
+                first = juce::jmin(first, i);
+                last = juce::jmax(last, i);
+            }
+        }
+    }
+
+    const int length = last - first + 1;
+
+    // Normalise to unit energy on the loudest channel, before the split so head
+    // and tail keep their balance
+    float maxEnergy = 0.0f;
+
+    for (int channel = 0; channel < channels; ++channel)
+    {
+        const float* data = ir.getReadPointer(channel, first);
+        float energy = 0.0f;
+
+        for (int i = 0; i < length; ++i)
+            energy += data[i] * data[i];
+
+        maxEnergy = juce::jmax(maxEnergy, energy);
+    }
+
+    const float gain = 1.0f / std::sqrt(maxEnergy);
+
+    // Split: head for the audio thread, the rest (if any) for the worker
+    const int headSamples = juce::jmin(length, head);
+    const int tailSamples = length - headSamples;
+
+    juce::AudioBuffer<float> headIR(channels, headSamples);
+    juce::AudioBuffer<float> tailIR(channels, juce::jmax(1, tailSamples));
+    tailIR.clear();
+
+    for (int channel = 0; channel < channels; ++channel)
+    {
+        headIR.copyFrom(channel, 0, ir.getReadPointer(channel, first), headSamples, gain);
+
+        if (tailSamples > 0)
+            tailIR.copyFrom(channel, 0, ir.getReadPointer(channel, first + headSamples), tailSamples, gain);
+    }
+
+    // A newer request (or prepare) superseded this one while decoding
+    if (generation != loadGeneration.load())
+        return;
+
+    // Already trimmed and normalised as a whole; the tail must not be trimmed again
+    tailConvolution.loadImpulseResponse(std::move(tailIR), sampleRate,
+                                        juce::dsp::Convolution::Stereo::yes,
+                                        juce::dsp::Convolution::Trim::no,
+                                        juce::dsp::Convolution::Normalise::no);
+    headConvolution.loadImpulseResponse(std::move(headIR), sampleRate,
+                                        juce::dsp::Convolution::Stereo::yes,
+                                        juce::dsp::Convolution::Trim::no,
+                                        juce::dsp::Convolution::Normalise::no);
+
+    irLength.store(length);
+    hasImpulseResponse.store(true, std::memory_order_release);
+
+    workers->add(*this);
+}
@@ -0,0 +1,159 @@
+#pragma once
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_dsp/juce_dsp.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+class ConvolutionReverb;
+
+// Threads shared by every ConvolutionReverb in the process: a small pool that
+// runs the tail partitions, and one IR loader.
+//
+// Instances register once they have an IR. An audio thread that completes a
+// partition signals a single event; the worker it wakes claims each instance
+// with pending partitions (one worker per instance at a time, so a tail stays
+// in order), wakes the next worker for the others and catches the instance up.
+// Nothing polls: without pending work every worker sleeps on the event. The
+// pool is started by the first registration, so no threads run until an IR is
+// loaded.
+class ConvolutionTailWorkers
+{
+public:
+    ConvolutionTailWorkers() = default;
+    ~ConvolutionTailWorkers();
+
+    // Message or loader thread. remove() returns once no worker is inside the instance.
+    void add(ConvolutionReverb& instance);
+    void remove(ConvolutionReverb& instance);
+
+    // Audio thread
+    void wake() { work.signal(); }
+
+    juce::ThreadPool loader { 1 };  // Decodes IR files for every instance, one at a time
+
+private:
+    class Worker : public juce::Thread
+    {
+    public:
+        explicit Worker(ConvolutionTailWorkers& o) : juce::Thread("DriveVerb convolution tail"), owner(o) {}
+        void run() override;
+
+    private:
+        ConvolutionTailWorkers& owner;
+    };
+
+    void service();
+
+    juce::WaitableEvent work;
+    juce::ReadWriteLock instancesLock;  // Workers read; add/remove write
+    juce::Array<ConvolutionReverb*> instances;
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ConvolutionTailWorkers)
+};
+
+//==============================================================================
+// Zero-latency convolution reverb for long impulse responses.
+//
+// The IR is split in two. The head (the first headLength samples) runs on the
+// audio thread with a non-uniformly partitioned juce::dsp::Convolution, so the
+// early reflections arrive with no latency. The tail runs on the shared workers
+// in fixed partitionSize blocks: the audio thread queues its input in a ring
+// and wakes them at each partition boundary, and a worker writes the tail into
+// an output ring headLength samples ahead. Host blocks are processed in chunks
+// of at most the prepared size, and the head is at least a partition plus two
+// such chunks long, so the worker has a whole chunk period to finish. If it
+// still runs late, that part of the tail is dropped rather than read
+// half-written.
+//
+// IR files are decoded, resampled, trimmed and normalised on the shared
+// loader. Then both halves are handed to their engines, which swap them in
+// with a crossfade.
+class ConvolutionReverb
+{
+public:
+    static constexpr int partitionSize = 2048;
+    static constexpr double maxIRSeconds = 30.0;
+
+    ConvolutionReverb();
+    ~ConvolutionReverb();
+
+    // Drops the IR and takes the instance off the tail workers; call from prepareToPlay only
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    // Audio thread. Replaces the block with the reverb (silence until an IR is loaded).
+    void process(const juce::dsp::ProcessContextReplacing<float>& context);
+
+    // Any thread; the file is read on the loader. Requests made before prepare() are
+    // dropped, so the owner reloads its file from prepareToPlay.
+    void loadImpulseResponse(const juce::File& file);
+
+    // Loaded IR length in samples at the processing rate (0 when none)
+    int getCurrentIRSize() const { return irLength.load(std::memory_order_relaxed); }
+
+private:
+    friend class ConvolutionTailWorkers;
+
+    struct LoadJob : public juce::ThreadPoolJob
+    {
+        LoadJob(ConvolutionReverb& o, const juce::File& f, juce::uint32 g)
+            : juce::ThreadPoolJob("DriveVerb IR load"), owner(o), file(f), generation(g) {}
+
+        JobStatus runJob() override
+        {
+            owner.loadInBackground(file, generation);
+            return jobHasFinished;
+        }
+
+        ConvolutionReverb& owner;
+        const juce::File file;
+        const juce::uint32 generation;
+    };
+
+    void processChunk(juce::dsp::AudioBlock<float> block);
+
+    // Tail workers: claim/release keep one worker per instance at a time
+    bool hasPendingTail() const;
+    bool claimTail();
+    void releaseTail() { tailBusy.store(false, std::memory_order_release); }
+    void serviceTail();
+    bool processTailPartition(juce::int64 partition);  // false if the input was overrun
+
+    void removeLoadJobs();
+    void loadInBackground(const juce::File& file, juce::uint32 generation);
+
+    // Declared first so the last instance's workers outlive everything below
+    juce::SharedResourcePointer<ConvolutionTailWorkers> workers;
+
+    juce::dsp::Convolution headConvolution { juce::dsp::Convolution::NonUniform { 512 } };
+    juce::dsp::Convolution tailConvolution;  // Uniform partitions of partitionSize (worker only)
+
+    juce::AudioBuffer<float> inputRing;    // Written by the audio thread, read by the worker
+    juce::AudioBuffer<float> outputRing;   // Written by the worker, read by the audio thread
+    juce::AudioBuffer<float> tailScratch;  // One partition (worker only)
+    int inputMask = 0;
+    int outputMask = 0;
+    int numChannels = 0;
+    int maxBlockSize = 1;
+
+    std::atomic<int> headLength { 2 * partitionSize };
+    std::atomic<double> processingSampleRate { 0.0 };
+
+    // Timeline, in samples since prepare()
+    std::atomic<juce::int64> samplesPushed { 0 };        // Audio thread -> worker
+    std::atomic<juce::int64> resetPosition { 0 };        // Input before this is treated as silence
+    std::atomic<juce::int64> completedPartitions { 0 };  // Worker -> audio thread
+    std::atomic<juce::int64> tailValidFrom { 0 };        // Worker skipped ahead; earlier tail is stale
+    juce::int64 appliedReset = 0;                        // Worker only
+    std::atomic<bool> tailBusy { false };
+
+    std::atomic<bool> hasImpulseResponse { false };
+    std::atomic<int> irLength { 0 };
+    std::atomic<juce::uint32> loadGeneration { 0 };
+
+    juce::AudioFormatManager formatManager;  // Loader only
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ConvolutionReverb)
+};
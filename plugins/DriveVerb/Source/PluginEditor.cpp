@@ -11,6 +11,8 @@ DriveVerbAudioProcessorEditor::DriveVerbAudioProcessorEditor(DriveVerbAudioProce
     driveRelay = std::make_unique<juce::WebSliderRelay>("drive");
     filterRelay = std::make_unique<juce::WebSliderRelay>("filter");
     filterPositionRelay = std::make_unique<juce::WebToggleButtonRelay>("filterPosition");
+    reverbEngineRelay = std::make_unique<juce::WebComboBoxRelay>("reverbEngine");
+    driveQualityRelay = std::make_unique<juce::WebComboBoxRelay>("driveQuality");
 
     // 2️⃣ Create WebView with relays (Pattern #8 - explicit URL mapping)
     webView = std::make_unique<juce::WebBrowserComponent>(
@@ -23,6 +25,19 @@ DriveVerbAudioProcessorEditor::DriveVerbAudioProcessorEditor(DriveVerbAudioProce
             .withOptionsFrom(*driveRelay)
             .withOptionsFrom(*filterRelay)
             .withOptionsFrom(*filterPositionRelay)
+            .withOptionsFrom(*reverbEngineRelay)
+            .withOptionsFrom(*driveQualityRelay)
+            .withNativeFunction("chooseImpulseResponse",
+                [this](const juce::Array<juce::var>&, juce::WebBrowserComponent::NativeFunctionCompletion completion)
+                {
+                    chooseImpulseResponse();
+                    completion(juce::var());
+                })
+            .withNativeFunction("getImpulseResponseName",
+                [this](const juce::Array<juce::var>&, juce::WebBrowserComponent::NativeFunctionCompletion completion)
+                {
+                    completion(processorRef.getImpulseResponseFile().getFileName());
+                })
     );
 
     // 3️⃣ Create attachments LAST (Pattern #11, #12 - THREE parameters including nullptr)
@@ -38,6 +53,10 @@ DriveVerbAudioProcessorEditor::DriveVerbAudioProcessorEditor(DriveVerbAudioProce
         *processorRef.parameters.getParameter("filter"), *filterRelay, nullptr);
     filterPositionAttachment = std::make_unique<juce::WebToggleButtonParameterAttachment>(
         *processorRef.parameters.getParameter("filterPosition"), *filterPositionRelay, nullptr);
+    reverbEngineAttachment = std::make_unique<juce::WebComboBoxParameterAttachment>(
+        *processorRef.parameters.getParameter("reverbEngine"), *reverbEngineRelay, nullptr);
+    driveQualityAttachment = std::make_unique<juce::WebComboBoxParameterAttachment>(
+        *processorRef.parameters.getParameter("driveQuality"), *driveQualityRelay, nullptr);
 
     addAndMakeVisible(*webView);
     webView->goToURL(juce::WebBrowserComponent::getResourceProviderRoot());
@@ -77,9 +96,42 @@ void DriveVerbAudioProcessorEditor::timerCallback()
             driveLevelDB
         );
         webView->evaluateJavascript(js);
+
+        // IR name (changes on load and when a session restores another IR)
+        const auto irName = processorRef.getImpulseResponseFile().getFileName();
+        if (irName != lastImpulseResponseName)
+        {
+            lastImpulseResponseName = irName;
+            webView->evaluateJavascript(
+                "window.dispatchEvent(new CustomEvent('updateImpulseResponse', { detail: "
+                + juce::JSON::toString(juce::var(irName)) + " }));");
+        }
     }
 }
 
+void DriveVerbAudioProcessorEditor::chooseImpulseResponse()
+{
+    impulseResponseChooser = std::make_unique<juce::FileChooser>(
+        "Load Impulse Response",
+        processorRef.getImpulseResponseFile(),
+        "*.wav;*.aif;*.aiff;*.flac");
+
+    impulseResponseChooser->launchAsync(
+        juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles,
+        [this](const juce::FileChooser& chooser)
+        {
+            const auto file = chooser.getResult();
+            if (! file.existsAsFile())
+                return;
+
+            processorRef.loadImpulseResponse(file);
+
+            // Loading an IR implies wanting to hear it
+            if (auto* engine = processorRef.parameters.getParameter("reverbEngine"))
+                engine->setValueNotifyingHost(engine->convertTo0to1(1.0f));
+        });
+}
+
 std::optional<juce::WebBrowserComponent::Resource>
 DriveVerbAudioProcessorEditor::getResource(const juce::String& url)
 {
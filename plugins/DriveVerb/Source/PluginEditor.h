@@ -28,6 +28,8 @@ private:
     std::unique_ptr<juce::WebSliderRelay> driveRelay;
     std::unique_ptr<juce::WebSliderRelay> filterRelay;
     std::unique_ptr<juce::WebToggleButtonRelay> filterPositionRelay;
+    std::unique_ptr<juce::WebComboBoxRelay> reverbEngineRelay;
+    std::unique_ptr<juce::WebComboBoxRelay> driveQualityRelay;
 
     // 2️⃣ WEBVIEW SECOND (depends on relays via withOptionsFrom)
     std::unique_ptr<juce::WebBrowserComponent> webView;
@@ -39,6 +41,13 @@ private:
     std::unique_ptr<juce::WebSliderParameterAttachment> driveAttachment;
     std::unique_ptr<juce::WebSliderParameterAttachment> filterAttachment;
     std::unique_ptr<juce::WebToggleButtonParameterAttachment> filterPositionAttachment;
+    std::unique_ptr<juce::WebComboBoxParameterAttachment> reverbEngineAttachment;
+    std::unique_ptr<juce::WebComboBoxParameterAttachment> driveQualityAttachment;
+
+    // Convolution engine: IR file picker (opened from the UI's LOAD IR button)
+    std::unique_ptr<juce::FileChooser> impulseResponseChooser;
+    juce::String lastImpulseResponseName;  // Last name sent to the UI
+    void chooseImpulseResponse();
 
     // Helper for resource serving (Pattern #8)
     std::optional<juce::WebBrowserComponent::Resource> getResource(const juce::String& url);
@@ -50,6 +50,22 @@ juce::AudioProcessorValueTreeState::ParameterLayout DriveVerbAudioProcessor::cre
         "%"
     ));
 
+    // DRIVE QUALITY - Saturation oversampling (1x/2x/4x/8x, default 1x)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "driveQuality", 1 },
+        "Drive Quality",
+        OversampledSaturator::getQualityNames(),
+        0
+    ));
+
+    // REVERB ENGINE - Algorithmic (juce::dsp::Reverb) or Convolution (loaded IR file)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "reverbEngine", 1 },
+        "Reverb Engine",
+        juce::StringArray { "Algorithmic", "Convolution" },
+        0
+    ));
+
     // FILTER POSITION - Pre/Post toggle (0.0=PRE, 1.0=POST, default 1.0)
     layout.add(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID { "filterPosition", 1 },
@@ -81,26 +97,56 @@ void DriveVerbAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlo
     spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
     spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
 
-    // Prepare reverb
+    // Prepare reverb engines
     reverb.prepare(spec);
+    convolution.prepare(spec);
 
     // Prepare dry/wet mixer
     dryWetMixer.prepare(spec);
     dryWetMixer.setMixingRule(juce::dsp::DryWetMixingRule::balanced); // Equal-power mixing
 
-    // Prepare drive waveshaper with tanh transfer function (Stage 4.2)
-    driveShaper.prepare(spec);
-    driveShaper.functionToUse = [](float sample) { return std::tanh(sample); };
+    // Prepare oversampled tanh saturation (Stage 4.2)
+    driveSaturator.prepare(spec);
+
+    // Resolve the offline boost now: a bounce's latency must be reported before it starts
+    updateDriveQuality();
 
     // Prepare DJ-style filter (Stage 4.3)
     filterProcessor.prepare(spec);
+
+    // The convolution engine splits its IR for this rate and block size: reload it
+    auto irFile = getImpulseResponseFile();
+    if (irFile.existsAsFile())
+        convolution.loadImpulseResponse(irFile);
+
+    // Tail tracking (reverb output is continuous, so a short quiet hold suffices)
+    tailTracker.prepare(sampleRate);
+    tailTracker.setQuietHoldSeconds(0.1);
+}
+
+void DriveVerbAudioProcessor::updateDriveQuality()
+{
+    // Live: the user's choice. Bouncing: at least 4x (latency follows, reported below)
+    renderQuality.update(*this);
+
+    auto* driveQualityParam = parameters.getRawParameterValue("driveQuality");
+    driveSaturator.setQuality(renderQuality.atLeastWhenOffline(static_cast<int>(driveQualityParam->load()), 2));
+
+    // Oversampling latency is on the wet path only, so delay the dry path to match
+    // and report it to the host
+    const int saturatorLatency = driveSaturator.getLatencyInSamples();
+    dryWetMixer.setWetLatency(static_cast<float>(saturatorLatency));
+
+    if (saturatorLatency != getLatencySamples())
+        setLatencySamples(saturatorLatency);
 }
 
 void DriveVerbAudioProcessor::releaseResources()
 {
     reverb.reset();
+    convolution.reset();
     dryWetMixer.reset();
-    driveShaper.reset();
+    driveSaturator.reset();
     filterProcessor.reset();
 }
 
@@ -123,8 +169,34 @@ void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     float driveValue = driveParam->load();    // 0-24dB
     float filterValue = filterParam->load();  // -100% to +100%
     bool isPostMode = filterPositionParam->load() > 0.5f;  // false=PRE, true=POST
+    int reverbEngine = static_cast<int>(parameters.getRawParameterValue("reverbEngine")->load());
+
+    // Switching engines: start the newly active one from silence
+    if (reverbEngine != lastReverbEngine)
+    {
+        reverb.reset();
+        convolution.reset();
+        lastReverbEngine = reverbEngine;
+    }
+
+    // Drive quality can change at any time (latency follows)
+    updateDriveQuality();
 
-    // Update reverb parameters
+    // Tail: the loaded IR's length for convolution; the algorithmic engine only
+    // loosely follows DECAY, so allow headroom
+    const double tailSeconds = reverbEngine == 1
+        ? static_cast<double>(convolution.getCurrentIRSize()) / getSampleRate()
+        : static_cast<double>(decayValue) * 1.5;
+    tailTracker.setTailLengthSeconds(tailSeconds + 0.05);
+
+    // Idle: input silent and the tail has died away - skip all DSP
+    if (tailTracker.processInput(buffer, getTotalNumInputChannels()))
+    {
+        driveOutputLevelDB.store(-60.0f);
+        return;
+    }
+
+    // Update reverb parameters (algorithmic engine; size/decay don't apply to a loaded IR)
     juce::dsp::Reverb::Parameters reverbParams;
     reverbParams.roomSize = sizeValue / 100.0f;  // Normalize to 0-1
     reverbParams.damping = 0.5f;                  // Fixed for now (could add parameter later)
@@ -151,7 +223,10 @@ void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     dryWetMixer.pushDrySamples(block);
 
     // Process reverb
-    reverb.process(context);
+    if (reverbEngine == 1)
+        convolution.process(context);
+    else
+        reverb.process(context);
 
     // Stage 4.4: PRE/POST routing - apply drive and filter in different orders
     // PRE mode (filterPosition=0.0): Filter → Drive
@@ -160,49 +235,31 @@ void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     if (isPostMode)
     {
         // POST MODE: Drive → Filter (drive affects harmonics, then filter shapes them)
-        applyDrive(block, context, driveValue);
-        applyFilter(block, context, filterValue);
+        applyDrive(block, driveValue);
+        applyFilter(block, filterValue);
     }
     else
     {
         // PRE MODE: Filter → Drive (filter shapes frequency content, then drive adds harmonics)
-        applyFilter(block, context, filterValue);
-        applyDrive(block, context, driveValue);
+        applyFilter(block, filterValue);
+        applyDrive(block, driveValue);
     }
 
     // Mix dry and wet signals
     dryWetMixer.mixWetSamples(block);
+
+    tailTracker.processOutput(buffer);
 }
 
-void DriveVerbAudioProcessor::applyDrive(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float driveValue)
+void DriveVerbAudioProcessor::applyDrive(juce::dsp::AudioBlock<float>& block, float driveValue)
 {
     // Apply drive to wet signal (Stage 4.2)
     // Convert dB to linear gain: gain = 10^(dB/20)
     float driveGain = std::pow(10.0f, driveValue / 20.0f);
 
-    // Apply gain before waveshaping (increases saturation with higher drive)
-    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
-    {
-        auto* channelData = block.getChannelPointer(channel);
-        for (size_t sample = 0; sample < block.getNumSamples(); ++sample)
-        {
-            channelData[sample] *= driveGain;
-        }
-    }
-
-    // Apply tanh waveshaping (tape-like saturation)
-    driveShaper.process(context);
-
-    // Measure output level for VU meter (after waveshaping)
-    float maxLevel = 0.0f;
-    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
-    {
-        const float* channelData = block.getChannelPointer(channel);
-        for (size_t sample = 0; sample < block.getNumSamples(); ++sample)
-        {
-            maxLevel = std::max(maxLevel, std::abs(channelData[sample]));
-        }
-    }
+    // Gain, tanh waveshaping (tape-like saturation) and VU peak in one fused pass
+    // at the selected oversampling rate
+    float maxLevel = driveSaturator.process(block, driveGain);
 
     // Convert to dB and store atomically
     float levelDB = maxLevel > 0.0f
@@ -211,59 +268,30 @@ void DriveVerbAudioProcessor::applyDrive(juce::dsp::AudioBlock<float>& block, ju
     driveOutputLevelDB.store(levelDB);
 }
 
-void DriveVerbAudioProcessor::applyFilter(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float filterValue)
+void DriveVerbAudioProcessor::applyFilter(juce::dsp::AudioBlock<float>& block, float filterValue)
 {
     // Apply DJ-style filter (Stage 4.3)
-    // Center bypass zone: ±0.5% = no filtering (prevents filter artifacts at bypass)
-    if (std::abs(filterValue) > 0.5f)
-    {
-        float sampleRate = static_cast<float>(getSampleRate());
-        bool isLowPass = (filterValue < 0.0f);
-
-        // Reset filter state when switching between low-pass and high-pass
-        // Prevents burst caused by residual energy in delay buffers
-        if (isLowPass != previousWasLowPass)
-        {
-            filterProcessor.reset();
-        }
-        previousWasLowPass = isLowPass;
-
-        if (isLowPass)
-        {
-            // Low-pass filter (negative values)
-            // Exponential mapping: -100% = 200Hz (heavy bass), 0% = 20kHz (bypass)
-            float normalizedValue = std::abs(filterValue) / 100.0f; // 0.0 to 1.0
-            float cutoffHz = 20000.0f * std::pow(10.0f, -normalizedValue * std::log10(20000.0f / 200.0f));
-
-            *filterProcessor.state = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                sampleRate, juce::jlimit(200.0f, 20000.0f, cutoffHz), 0.707f
-            );
-        }
-        else
-        {
-            // High-pass filter (positive values)
-            // Exponential mapping: 0% = 20Hz (bypass), +100% = 10kHz (heavy treble)
-            float normalizedValue = filterValue / 100.0f; // 0.0 to 1.0
-            float cutoffHz = 20.0f * std::pow(10.0f, normalizedValue * std::log10(10000.0f / 20.0f));
-
-            *filterProcessor.state = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-                sampleRate, juce::jlimit(20.0f, 10000.0f, cutoffHz), 0.707f
-            );
-        }
-
-        // Process buffer through filter
-        filterProcessor.process(context);
-    }
-    else
-    {
-        // Reset filter state when entering bypass zone
-        // Prevents residual energy when re-entering filter range
-        if (previousWasLowPass)
-        {
-            filterProcessor.reset();
-            previousWasLowPass = false;
-        }
-    }
+    // Negative = low-pass (20kHz → 200Hz), positive = high-pass (20Hz → 10kHz)
+    // Center bypass zone: ±0.5% = no filtering (handled by DJFilter)
+    filterProcessor.setFilterAmount(filterValue);
+    filterProcessor.process(block);
+}
+
+void DriveVerbAudioProcessor::loadImpulseResponse(const juce::File& irFile)
+{
+    // Remember the path with the plugin state so sessions reload the same IR
+    parameters.state.setProperty("irPath", irFile.getFullPathName(), nullptr);
+
+    // Decoding, resampling and splitting happen on the convolution's loader thread;
+    // the new IR is swapped in on the audio thread once it's ready
+    if (irFile.existsAsFile())
+        convolution.loadImpulseResponse(irFile);
+}
+
+juce::File DriveVerbAudioProcessor::getImpulseResponseFile() const
+{
+    const auto path = parameters.state.getProperty("irPath").toString();
+    return path.isNotEmpty() ? juce::File(path) : juce::File();
 }
 
 juce::AudioProcessorEditor* DriveVerbAudioProcessor::createEditor()
@@ -283,7 +311,14 @@ void DriveVerbAudioProcessor::setStateInformation(const void* data, int sizeInBy
     std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
 
     if (xmlState != nullptr && xmlState->hasTagName(parameters.state.getType()))
+    {
         parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
+
+        // Reload the saved impulse response (if any) for the convolution engine
+        auto irFile = getImpulseResponseFile();
+        if (irFile != juce::File())
+            loadImpulseResponse(irFile);
+    }
 }
 
 // Factory function
@@ -1,6 +1,11 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "DJFilter.h"
+#include "OversampledSaturator.h"
+#include "TailTracker.h"
+#include "RenderQuality.h"
+#include "ConvolutionReverb.h"
 
 class DriveVerbAudioProcessor : public juce::AudioProcessor
 {
@@ -19,7 +24,7 @@ public:
     bool acceptsMidi() const override { return false; }
     bool producesMidi() const override { return false; }
     bool isMidiEffect() const override { return false; }
-    double getTailLengthSeconds() const override { return 0.0; }
+    double getTailLengthSeconds() const override { return tailTracker.getTailLengthSeconds(); }
 
     int getNumPrograms() override { return 1; }
     int getCurrentProgram() override { return 0; }
@@ -36,6 +41,10 @@ public:
     // VU meter support
     float getDriveOutputLevel() const { return driveOutputLevelDB.load(); }
 
+    // Convolution engine: impulse response file (loaded in the background, path saved with state)
+    void loadImpulseResponse(const juce::File& irFile);
+    juce::File getImpulseResponseFile() const;
+
 private:
 
     // Parameter layout creation
@@ -43,18 +52,31 @@ private:
 
     // DSP Components (Stage 4.1: Core reverb + dry/wet mixing)
     juce::dsp::Reverb reverb;
-    juce::dsp::DryWetMixer<float> dryWetMixer;
 
-    // Stage 4.2: Drive saturation
-    juce::dsp::WaveShaper<float> driveShaper;
+    // Convolution engine (reverbEngine = 1): zero latency. The IR head is convolved
+    // here, the long tail on workers shared by all instances; IR files load in the background.
+    ConvolutionReverb convolution;
+    int lastReverbEngine = 0;
+    juce::dsp::DryWetMixer<float> dryWetMixer { 1024 };  // Room for saturator latency compensation
+
+    // Stage 4.2: Drive saturation (oversampled, driveQuality selects 1x-8x)
+    OversampledSaturator driveSaturator;
 
     // Stage 4.3: DJ-style filter (low-pass/high-pass with center bypass)
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> filterProcessor;
-    bool previousWasLowPass = false;  // Track filter type transitions
+    DJFilter filterProcessor;  // Shared allocation-free bipolar LP/HP filter
+
+    // Tail length for the host + idle bypass once input and tail are silent
+    TailTracker tailTracker;
+
+    // Offline bounces run the saturator at 4x or more
+    RenderQuality renderQuality;
+
+    // Applies driveQuality (boosted offline) and keeps mixer/host latency in sync
+    void updateDriveQuality();
 
     // Stage 4.4: Helper methods for PRE/POST routing
-    void applyDrive(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float driveValue);
-    void applyFilter(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float filterValue);
+    void applyDrive(juce::dsp::AudioBlock<float>& block, float driveValue);
+    void applyFilter(juce::dsp::AudioBlock<float>& block, float filterValue);
 
     // VU meter - drive output level
     std::atomic<float> driveOutputLevelDB { -60.0f };
@@ -218,6 +218,9 @@ Drum808AudioProcessor::Drum808AudioProcessor()
                         .withOutput("Open Hat", juce::AudioChannelSet::stereo(), false))
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
+    // F#1 (Closed Hat) chokes A#1 (Open Hat)
+    chokeGroups.setNoteGroup(46, openHatChokeGroup);
+    chokeGroups.setNoteChokesGroup(42, openHatChokeGroup);
 }
 
 Drum808AudioProcessor::~Drum808AudioProcessor()
@@ -394,53 +397,51 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     const float closedHatCenterFreq = 6000.0f + (closedHatTone * 6000.0f); // 6-12 kHz
     const float openHatCenterFreq = 6000.0f + (openHatTone * 6000.0f);
 
-    // Process MIDI messages
-    for (const auto metadata : midiMessages)
+    // MIDI note-on handler (called at each event's exact sample position)
+    auto handleNoteOn = [&](const juce::MidiMessage& message)
     {
-        auto message = metadata.getMessage();
+        int note = message.getNoteNumber();
+        float velocity = message.getVelocity() / 127.0f;
 
-        if (message.isNoteOn())
-        {
-            int note = message.getNoteNumber();
-            float velocity = message.getVelocity() / 127.0f;
-
-            // Map MIDI notes to voices
-            if (note == 36) // C1 → Kick
-            {
-                kick.trigger(velocity);
-                kickTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 38) // D1 → Clap
-            {
-                clap.trigger(velocity);
-                clapTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 41) // F1 → Low Tom
-            {
-                lowTom.trigger(velocity, lowTomBaseFreq);
-                lowTomTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 42) // F#1 → Closed Hat (CHOKES open hat)
-            {
-                // FIRST: Choke open hat (stop immediately)
-                openHat.stop();
+        // Closed hat chokes open hat before anything is triggered
+        chokeGroups.noteOn(note, [this](int) { openHat.stop(); });
 
-                // THEN: Trigger closed hat
-                closedHat.trigger(velocity);
-                closedHatTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 45) // A1 → Mid Tom
-            {
-                midTom.trigger(velocity, midTomBaseFreq);
-                midTomTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 46) // A#1 → Open Hat
-            {
-                openHat.trigger(velocity);
-                openHatTriggered.store(true, std::memory_order_relaxed);
-            }
+        // Map MIDI notes to voices
+        if (note == 36) // C1 → Kick
+        {
+            kick.trigger(velocity);
+            kickTriggered.store(true, std::memory_order_relaxed);
         }
-    }
+        else if (note == 38) // D1 → Clap
+        {
+            clap.trigger(velocity);
+            clapTriggered.store(true, std::memory_order_relaxed);
+        }
+        else if (note == 41) // F1 → Low Tom
+        {
+            lowTom.trigger(velocity, lowTomBaseFreq);
+            lowTomTriggered.store(true, std::memory_order_relaxed);
+        }
+        else if (note == 42) // F#1 → Closed Hat (CHOKES open hat)
+        {
+            closedHat.trigger(velocity);
+            closedHatTriggered.store(true, std::memory_order_relaxed);
+        }
+        else if (note == 45) // A1 → Mid Tom
+        {
+            midTom.trigger(velocity, midTomBaseFreq);
+            midTomTriggered.store(true, std::memory_order_relaxed);
+        }
+        else if (note == 46) // A#1 → Open Hat
+        {
+            openHat.trigger(velocity);
+            chokeGroups.voiceStarted(openHatVoiceIndex, note);
+            openHatTriggered.store(true, std::memory_order_relaxed);
+        }
+    };
+
+    auto nextMidiEvent = midiMessages.cbegin();
+    const auto midiEnd = midiMessages.cend();
 
     // Configure clap filter (outside loop for efficiency)
     clap.bandpassFilter.setCutoffFrequency(clapCenterFreq);
@@ -449,6 +450,15 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     // Synthesize voices (per-sample processing)
     for (int sample = 0; sample < numSamples; ++sample)
     {
+        // Dispatch MIDI events that land on this sample (sample-accurate triggers and chokes)
+        for (; nextMidiEvent != midiEnd && (*nextMidiEvent).samplePosition <= sample; ++nextMidiEvent)
+        {
+            const auto message = (*nextMidiEvent).getMessage();
+
+            if (message.isNoteOn())
+                handleNoteOn(message);
+        }
+
         float kickSample = 0.0f;
         float lowTomSample = 0.0f;
         float midTomSample = 0.0f;
@@ -640,6 +650,7 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
             if (envelope < 1e-8f)
             {
                 openHat.stop();
+                chokeGroups.voiceStopped(openHatVoiceIndex);
                 envelope = 0.0f;
             }
 
@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "ChokeGroups.h"
 
 class Drum808AudioProcessor : public juce::AudioProcessor
 {
@@ -159,6 +160,11 @@ private:
     HiHatVoice openHat;
     ClapVoice clap;
 
+    // Choke groups (closed hat cuts open hat at the closed hat's exact sample)
+    static constexpr int openHatVoiceIndex = 0;
+    static constexpr int openHatChokeGroup = 0;
+    ChokeGroups chokeGroups;
+
     double currentSampleRate = 44100.0;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Drum808AudioProcessor)
@@ -183,17 +183,30 @@ void DrumRouletteVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer,
         // Get envelope value for this sample (Phase 4.2)
         const float envelopeValue = envelope.getNextSample();
 
-        // Linear interpolation for pitch shifting (Phase 4.2)
+        // Linear interpolation for pitch shifting (Phase 4.2); 4-point Hermite when rendering offline
         const float frac = currentPosition - static_cast<float>(intPosition);
 
         for (int channel = 0; channel < numChannels; ++channel)
         {
-            const float sample0 = sampleBuffer.getSample(channel, intPosition);
-            const float sample1 = sampleBuffer.getSample(channel, intPosition + 1);
+            const float* channelData = sampleBuffer.getReadPointer(channel);
+            const float sample0 = channelData[intPosition];
+            const float sample1 = channelData[intPosition + 1];
 
             // Interpolate between adjacent samples
             float interpolatedSample = sample0 + frac * (sample1 - sample0);
 
+            if (useCubicInterpolation)
+            {
+                // Edge samples repeat at the start/end of the buffer
+                const float sampleM1 = channelData[juce::jmax(0, intPosition - 1)];
+                const float sample2 = channelData[juce::jmin(sampleLength - 1, intPosition + 2)];
+
+                const float c1 = 0.5f * (sample1 - sampleM1);
+                const float c2 = sampleM1 - 2.5f * sample0 + 2.0f * sample1 - 0.5f * sample2;
+                const float c3 = 0.5f * (sample2 - sampleM1) + 1.5f * (sample0 - sample1);
+                interpolatedSample = ((c3 * frac + c2) * frac + c1) * frac + sample0;
+            }
+
             // Apply velocity and envelope
             float outputValue = interpolatedSample * noteVelocity * envelopeValue;
 
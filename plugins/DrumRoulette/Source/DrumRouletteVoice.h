@@ -25,6 +25,9 @@ public:
     void setSoloMutePointers(std::atomic<float>* solo, std::atomic<float>* mute, bool* anySoloActive);
     bool shouldRenderToMainMix() const;
 
+    // Cubic Hermite instead of linear interpolation (offline renders)
+    void setHighQualityInterpolation(bool shouldUseCubic) { useCubicInterpolation = shouldUseCubic; }
+
 private:
     int slotNumber;
     juce::AudioSampleBuffer sampleBuffer;
@@ -32,6 +35,7 @@ private:
     float noteVelocity = 1.0f;
     float pitchRatio = 1.0f;
     bool isActive = false;
+    bool useCubicInterpolation = false;
 
     // ADSR envelope (Phase 4.2)
     juce::ADSR envelope;
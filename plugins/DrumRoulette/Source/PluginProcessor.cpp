@@ -199,6 +199,14 @@ void DrumRouletteAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
         busBuffer.clear();
     }
 
+    // Offline bounce: higher-quality resampling for pitched samples
+    if (renderQuality.update(*this))
+    {
+        for (auto* voice : voices)
+            if (voice != nullptr)
+                voice->setHighQualityInterpolation(renderQuality.isOfflineRender());
+    }
+
     // Phase 4.4: Update anySoloActive flag for voice access
     anySoloActive = false;
     for (int slot = 0; slot < 8; ++slot)
@@ -2,6 +2,7 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_audio_formats/juce_audio_formats.h>
 #include "DrumRouletteVoice.h"
+#include "RenderQuality.h"
 
 class DrumRouletteAudioProcessor : public juce::AudioProcessor,
                                     public juce::AudioProcessorValueTreeState::Listener
@@ -69,5 +70,8 @@ private:
     // Phase 4.4: Solo/mute state tracking
     bool anySoloActive = false;
 
+    // Offline bounces switch voices to cubic interpolation
+    RenderQuality renderQuality;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DrumRouletteAudioProcessor)
 };
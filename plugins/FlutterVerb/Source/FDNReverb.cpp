@@ -0,0 +1,193 @@
+#include "FDNReverb.h"
+
+namespace
+{
+    // Mutually prime-ish line lengths (ms at SIZE = 50%)
+    constexpr float baseDelayMs[] = { 29.7f, 37.1f, 41.1f, 43.7f, 53.3f, 59.9f, 67.7f, 79.3f };
+
+    // Slow, detuned per-line LFOs for chorused tails
+    constexpr float lfoRatesHz[] = { 0.31f, 0.37f, 0.43f, 0.53f, 0.61f, 0.71f, 0.83f, 0.97f };
+
+    constexpr float modDepthMs = 0.5f;
+    constexpr float inputGain = 0.5f;
+    constexpr float outputGain = 0.35f;
+}
+
+void FDNReverb::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    sampleRate = spec.sampleRate;
+
+    // Longest line at SIZE = 100% (1.5x) plus modulation headroom
+    const int maxDelaySamples = static_cast<int>(std::ceil(sampleRate * 0.001 * (baseDelayMs[numLines - 1] * 1.5f + modDepthMs))) + 4;
+    delayLength = juce::nextPowerOfTwo(maxDelaySamples);
+    delayMask = delayLength - 1;
+
+    delayStorage.allocate(static_cast<size_t>(delayLength * numLines + Vec::SIMDNumElements), true);
+    delayFrames = Vec::getNextSIMDAlignedPtr(delayStorage.get());
+
+    modDepthSamples = static_cast<float>(sampleRate * 0.001 * modDepthMs);
+
+    // Phasors start evenly spread around the circle
+    for (int line = 0; line < numLines; ++line)
+    {
+        const auto r = static_cast<size_t>(line / 4);
+        const auto lane = static_cast<size_t>(line % 4);
+        const float rotation = juce::MathConstants<float>::twoPi * lfoRatesHz[line] / static_cast<float>(sampleRate);
+        const float startPhase = juce::MathConstants<float>::twoPi * static_cast<float>(line) / static_cast<float>(numLines);
+
+        rotCos[r].set(lane, std::cos(rotation));
+        rotSin[r].set(lane, std::sin(rotation));
+        lfoCos[r].set(lane, std::cos(startPhase));
+        lfoSin[r].set(lane, std::sin(startPhase));
+    }
+
+    for (size_t lane = 0; lane < 4; ++lane)
+    {
+        outSignsLeft.set(lane, (lane % 2 == 0) ? 1.0f : -1.0f);
+        outSignsRight.set(lane, (lane < 2) ? 1.0f : -1.0f);
+    }
+
+    updateLineSettings();
+    reset();
+}
+
+void FDNReverb::reset()
+{
+    if (delayFrames != nullptr)
+        std::fill(delayFrames, delayFrames + delayLength * numLines, 0.0f);
+
+    for (auto& state : dampState)
+        state = Vec::expand(0.0f);
+
+    writePos = 0;
+}
+
+void FDNReverb::setParameters(const Parameters& newParams)
+{
+    // Loop gains need a pow() per line, so only recompute when something moved
+    if (newParams.size == params.size
+        && newParams.decaySeconds == params.decaySeconds
+        && newParams.damping == params.damping)
+        return;
+
+    params = newParams;
+    updateLineSettings();
+}
+
+void FDNReverb::updateLineSettings()
+{
+    const float sizeScale = 0.5f + juce::jlimit(0.0f, 1.0f, params.size);  // 0.5x-1.5x
+    const float decaySamples = juce::jmax(0.01f, params.decaySeconds) * static_cast<float>(sampleRate);
+
+    for (int line = 0; line < numLines; ++line)
+    {
+        lineDelay[(size_t) line] = baseDelayMs[line] * 0.001f * static_cast<float>(sampleRate) * sizeScale;
+
+        // -60 dB after decaySeconds, regardless of line length
+        const float gain = std::pow(10.0f, -3.0f * lineDelay[(size_t) line] / decaySamples);
+        loopGain[line / 4].set(static_cast<size_t>(line % 4), gain);
+    }
+
+    // One-pole lowpass in each loop: 1 = no damping
+    dampCoeff = Vec::expand(1.0f - 0.85f * juce::jlimit(0.0f, 1.0f, params.damping));
+}
+
+void FDNReverb::process(const juce::dsp::ProcessContextReplacing<float>& context)
+{
+    auto& inputBlock = context.getInputBlock();
+    auto& outputBlock = context.getOutputBlock();
+
+    const auto numChannels = outputBlock.getNumChannels();
+    const auto numSamples = static_cast<int>(outputBlock.getNumSamples());
+
+    if (numChannels == 0 || delayFrames == nullptr)
+        return;
+
+    const float* inL = inputBlock.getChannelPointer(0);
+    const float* inR = numChannels > 1 ? inputBlock.getChannelPointer(1) : inL;
+    float* outL = outputBlock.getChannelPointer(0);
+    float* outR = numChannels > 1 ? outputBlock.getChannelPointer(1) : nullptr;
+
+    const float invSqrt2 = 1.0f / juce::MathConstants<float>::sqrt2;
+
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        const float dryL = inL[sample];
+        const float dryR = inR[sample];
+
+        // 1. Modulated fractional reads (the only per-line scalar work)
+        lfoSin[0].copyToRawArray(lfoValues);
+        lfoSin[1].copyToRawArray(lfoValues + 4);
+
+        for (int line = 0; line < numLines; ++line)
+        {
+            float readPos = static_cast<float>(writePos) - (lineDelay[(size_t) line] + modDepthSamples * lfoValues[line]);
+            if (readPos < 0.0f)
+                readPos += static_cast<float>(delayLength);
+
+            const int wholeSamples = static_cast<int>(readPos);
+            const float frac = readPos - static_cast<float>(wholeSamples);
+            const int index0 = wholeSamples & delayMask;
+            const int index1 = (wholeSamples + 1) & delayMask;
+
+            const float a = delayFrames[index0 * numLines + line];
+            const float b = delayFrames[index1 * numLines + line];
+            lineOutputs[line] = a + frac * (b - a);
+        }
+
+        Vec x[numRegisters] = { Vec::fromRawArray(lineOutputs), Vec::fromRawArray(lineOutputs + 4) };
+
+        // 2. Output taps (sign patterns decorrelate left and right)
+        outL[sample] = (x[0] * outSignsLeft + x[1] * outSignsRight).sum() * outputGain;
+        if (outR != nullptr)
+            outR[sample] = (x[0] * outSignsRight - x[1] * outSignsLeft).sum() * outputGain;
+
+        // 3. Damping and decay
+        for (int r = 0; r < numRegisters; ++r)
+        {
+            dampState[r] = dampState[r] + dampCoeff * (x[r] - dampState[r]);
+            x[r] = dampState[r] * loopGain[r];
+        }
+
+        // 4. Feedback matrix: Householder within each register, then H2 across
+        for (int r = 0; r < numRegisters; ++r)
+            x[r] = x[r] - Vec::expand(x[r].sum() * 0.5f);
+
+        const auto mixedA = (x[0] + x[1]) * invSqrt2;
+        const auto mixedB = (x[0] - x[1]) * invSqrt2;
+
+        // 5. Inject input (left into lines 0-3, right into lines 4-7) and write the frame
+        float* frame = delayFrames + writePos * numLines;
+        (mixedA + outSignsLeft * (dryL * inputGain)).copyToRawArray(frame);
+        (mixedB + outSignsLeft * (dryR * inputGain)).copyToRawArray(frame + 4);
+        writePos = (writePos + 1) & delayMask;
+
+        // 6. Advance LFO phasors
+        for (int r = 0; r < numRegisters; ++r)
+        {
+            const auto c = lfoCos[r] * rotCos[r] - lfoSin[r] * rotSin[r];
+            const auto s = lfoSin[r] * rotCos[r] + lfoCos[r] * rotSin[r];
+            lfoCos[r] = c;
+            lfoSin[r] = s;
+        }
+    }
+
+    // Rounding slowly changes phasor magnitude; pull it back to 1 once per block
+    renormalisePhasors();
+}
+
+void FDNReverb::renormalisePhasors()
+{
+    for (int r = 0; r < numRegisters; ++r)
+    {
+        for (size_t lane = 0; lane < 4; ++lane)
+        {
+            const float c = lfoCos[r].get(lane);
+            const float s = lfoSin[r].get(lane);
+            const float scale = 1.0f / std::sqrt(c * c + s * s);
+
+            lfoCos[r].set(lane, c * scale);
+            lfoSin[r].set(lane, s * scale);
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+
+// 8-line feedback delay network reverb (alternative to juce::dsp::Reverb).
+//
+// Lines are stored interleaved (one 8-float frame per write position) so the
+// feedback write, damping, decay and mixing all run on SIMD registers. The
+// feedback matrix is H2 (across registers) ⊗ 4x4 Householder (within a
+// register): orthogonal, every entry the same magnitude, and it needs only
+// vertical adds plus one horizontal sum per register. Each line's read tap
+// is modulated by its own slow LFO (rotating phasor, no trig per sample).
+class FDNReverb
+{
+public:
+    struct Parameters
+    {
+        float size = 0.5f;          // 0-1, scales all line lengths
+        float decaySeconds = 2.5f;  // RT60 of the tail
+        float damping = 0.5f;       // 0 = bright, 1 = dark
+    };
+
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+    void setParameters(const Parameters& newParams);
+
+    // Stereo (or mono) in-place processing, 100% wet output
+    void process(const juce::dsp::ProcessContextReplacing<float>& context);
+
+private:
+    using Vec = juce::dsp::SIMDRegister<float>;
+    static_assert(Vec::SIMDNumElements == 4, "FDN layout assumes 4-lane SIMD registers");
+
+    static constexpr int numLines = 8;
+    static constexpr int numRegisters = numLines / 4;
+
+    void updateLineSettings();
+    void renormalisePhasors();
+
+    double sampleRate = 44100.0;
+    Parameters params;
+
+    // Interleaved delay memory: frame i holds sample i of all 8 lines
+    juce::HeapBlock<float> delayStorage;
+    float* delayFrames = nullptr;
+    int delayLength = 0;   // Frames, power of two
+    int delayMask = 0;
+    int writePos = 0;
+
+    // Per-line base delay (samples), modulation depth and loop gain
+    std::array<float, numLines> lineDelay {};
+    float modDepthSamples = 0.0f;
+
+    Vec loopGain[numRegisters];
+    Vec dampCoeff;
+    Vec dampState[numRegisters];
+
+    // Rotating phasors: (cos, sin) advanced by a per-line rotation each sample
+    Vec lfoCos[numRegisters], lfoSin[numRegisters];
+    Vec rotCos[numRegisters], rotSin[numRegisters];
+
+    // Output tap signs (decorrelate left/right)
+    Vec outSignsLeft, outSignsRight;
+
+    alignas(sizeof(Vec)) float lineOutputs[numLines] {};
+    alignas(sizeof(Vec)) float lfoValues[numLines] {};
+};
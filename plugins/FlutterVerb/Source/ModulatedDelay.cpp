@@ -0,0 +1,140 @@
+#include "ModulatedDelay.h"
+
+void ModulatedDelay::prepare(const juce::dsp::ProcessSpec& spec, float maxDelayMs)
+{
+    sampleRate = spec.sampleRate;
+    maxBlockSize = static_cast<int>(spec.maximumBlockSize);
+    maxDelaySamples = static_cast<float>(sampleRate * maxDelayMs / 1000.0);
+
+    // Whole block is written before it is read, so leave room for both plus interpolation taps
+    const int bufferLength = juce::nextPowerOfTwo(static_cast<int>(std::ceil(maxDelaySamples)) + maxBlockSize + 4);
+    bufferMask = bufferLength - 1;
+    delayBuffer.setSize(static_cast<int>(spec.numChannels), bufferLength);
+
+    wowCurve.allocate(static_cast<size_t>(maxBlockSize), true);
+    delayCurve.allocate(static_cast<size_t>(maxBlockSize), true);
+
+    setLfoRates(wowHz, flutterHz);
+    reset();
+}
+
+void ModulatedDelay::reset()
+{
+    delayBuffer.clear();
+    writePos = 0;
+
+    wowCos = 1.0f;
+    wowSin = 0.0f;
+    flutterCos = 1.0f;
+    flutterSin = 0.0f;
+}
+
+void ModulatedDelay::setLfoRates(float newWowHz, float newFlutterHz)
+{
+    wowHz = newWowHz;
+    flutterHz = newFlutterHz;
+
+    const float wowInc = juce::MathConstants<float>::twoPi * wowHz / static_cast<float>(sampleRate);
+    const float flutterInc = juce::MathConstants<float>::twoPi * flutterHz / static_cast<float>(sampleRate);
+
+    wowRotCos = std::cos(wowInc);
+    wowRotSin = std::sin(wowInc);
+    flutterRotCos = std::cos(flutterInc);
+    flutterRotSin = std::sin(flutterInc);
+}
+
+void ModulatedDelay::process(juce::AudioBuffer<float>& buffer, float baseDelayMs, float depth)
+{
+    if (maxBlockSize == 0)
+        return;
+
+    const float baseDelaySamples = static_cast<float>(sampleRate * baseDelayMs / 1000.0);
+    const float depthSamples = baseDelaySamples * depth;
+
+    // Hosts may exceed the prepared block size
+    for (int start = 0; start < buffer.getNumSamples(); start += maxBlockSize)
+        processChunk(buffer, start, juce::jmin(maxBlockSize, buffer.getNumSamples() - start),
+                     baseDelaySamples, depthSamples);
+
+    // Rounding slowly changes phasor magnitude; pull it back to 1 once per block
+    const float wowScale = 1.0f / std::sqrt(wowCos * wowCos + wowSin * wowSin);
+    wowCos *= wowScale;
+    wowSin *= wowScale;
+
+    const float flutterScale = 1.0f / std::sqrt(flutterCos * flutterCos + flutterSin * flutterSin);
+    flutterCos *= flutterScale;
+    flutterSin *= flutterScale;
+}
+
+void ModulatedDelay::processChunk(juce::AudioBuffer<float>& buffer, int startSample, int numSamples,
+                                  float baseDelaySamples, float depthSamples)
+{
+    // 1. LFOs: advance both phasors, one rotation each per sample
+    float* wow = wowCurve.get();
+    float* curve = delayCurve.get();
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        wow[i] = wowSin;
+        curve[i] = flutterSin;
+
+        const float nextWowCos = wowCos * wowRotCos - wowSin * wowRotSin;
+        wowSin = wowSin * wowRotCos + wowCos * wowRotSin;
+        wowCos = nextWowCos;
+
+        const float nextFlutterCos = flutterCos * flutterRotCos - flutterSin * flutterRotSin;
+        flutterSin = flutterSin * flutterRotCos + flutterCos * flutterRotSin;
+        flutterCos = nextFlutterCos;
+    }
+
+    // 2. Delay curve in one vector pass: base + depth * (wow + flutter) / 2
+    juce::FloatVectorOperations::add(curve, wow, numSamples);
+    juce::FloatVectorOperations::multiply(curve, depthSamples * 0.5f, numSamples);
+    juce::FloatVectorOperations::add(curve, baseDelaySamples, numSamples);
+    juce::FloatVectorOperations::clip(curve, curve, 2.0f, maxDelaySamples, numSamples);
+
+    // 3. Per channel: write the block, then read it back through the modulated taps
+    const int bufferLength = delayBuffer.getNumSamples();
+    const int numChannels = juce::jmin(buffer.getNumChannels(), delayBuffer.getNumChannels());
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        float* channelData = buffer.getWritePointer(channel, startSample);
+
+        const int firstPart = juce::jmin(numSamples, bufferLength - writePos);
+        delayBuffer.copyFrom(channel, writePos, channelData, firstPart);
+        if (firstPart < numSamples)
+            delayBuffer.copyFrom(channel, 0, channelData + firstPart, numSamples - firstPart);
+
+        for (int i = 0; i < numSamples; ++i)
+            channelData[i] = readInterpolated(channel, static_cast<float>(writePos + i) - curve[i]);
+    }
+
+    writePos = (writePos + numSamples) & bufferMask;
+}
+
+float ModulatedDelay::readInterpolated(int channel, float readPos) const noexcept
+{
+    const float* data = delayBuffer.getReadPointer(channel);
+
+    if (readPos < 0.0f)
+        readPos += static_cast<float>(delayBuffer.getNumSamples());
+
+    const int index = static_cast<int>(readPos);
+    const float frac = readPos - static_cast<float>(index);
+
+    // 3rd-order Lagrange through taps at -1, 0, +1, +2
+    const float xm1 = data[(index - 1) & bufferMask];
+    const float x0 = data[index & bufferMask];
+    const float x1 = data[(index + 1) & bufferMask];
+    const float x2 = data[(index + 2) & bufferMask];
+
+    const float fm1 = frac + 1.0f;
+    const float f1 = frac - 1.0f;
+    const float f2 = frac - 2.0f;
+
+    return xm1 * (-frac * f1 * f2 / 6.0f)
+         + x0 * (fm1 * f1 * f2 * 0.5f)
+         + x1 * (-fm1 * frac * f2 * 0.5f)
+         + x2 * (fm1 * frac * f1 / 6.0f);
+}
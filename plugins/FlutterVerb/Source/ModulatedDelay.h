@@ -0,0 +1,42 @@
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+
+// Block-based wow/flutter delay.
+//
+// The wow and flutter LFOs are rotating phasors (no trig per sample) and are
+// shared by all channels, so the delay-time curve is built once per block with
+// vector operations and then read by every channel. Reads use a const 4-point
+// Lagrange tap, so changing the delay never mutates the line.
+class ModulatedDelay
+{
+public:
+    void prepare(const juce::dsp::ProcessSpec& spec, float maxDelayMs);
+    void reset();
+
+    void setLfoRates(float wowHz, float flutterHz);
+
+    // depth: peak modulation as a fraction of baseDelayMs (wow + flutter averaged)
+    void process(juce::AudioBuffer<float>& buffer, float baseDelayMs, float depth);
+
+private:
+    void processChunk(juce::AudioBuffer<float>& buffer, int startSample, int numSamples,
+                      float baseDelaySamples, float depthSamples);
+    float readInterpolated(int channel, float readPos) const noexcept;
+
+    double sampleRate = 44100.0;
+    int maxBlockSize = 0;
+
+    juce::AudioBuffer<float> delayBuffer;
+    int bufferMask = 0;
+    int writePos = 0;
+    float maxDelaySamples = 0.0f;
+
+    // Per-block scratch: wow curve, then total delay curve (samples)
+    juce::HeapBlock<float> wowCurve;
+    juce::HeapBlock<float> delayCurve;
+
+    // Rotating phasors (cos, sin) and their per-sample rotation
+    float wowCos = 1.0f, wowSin = 0.0f, wowRotCos = 1.0f, wowRotSin = 0.0f;
+    float flutterCos = 1.0f, flutterSin = 0.0f, flutterRotCos = 1.0f, flutterRotSin = 0.0f;
+    float wowHz = 1.0f, flutterHz = 6.0f;
+};
@@ -25,6 +25,7 @@ FlutterVerbAudioProcessorEditor::FlutterVerbAudioProcessorEditor(FlutterVerbAudi
     // FlutterVerb parameters:
     // - 6 continuous: SIZE, DECAY, MIX, AGE, DRIVE, TONE
     // - 1 toggle: MOD_MODE
+    // - 2 choices: DRIVE_QUALITY, REVERB_MODE
     //
     sizeRelay = std::make_unique<juce::WebSliderRelay>("SIZE");
     decayRelay = std::make_unique<juce::WebSliderRelay>("DECAY");
@@ -33,6 +34,8 @@ FlutterVerbAudioProcessorEditor::FlutterVerbAudioProcessorEditor(FlutterVerbAudi
     driveRelay = std::make_unique<juce::WebSliderRelay>("DRIVE");
     toneRelay = std::make_unique<juce::WebSliderRelay>("TONE");
     modModeRelay = std::make_unique<juce::WebToggleButtonRelay>("MOD_MODE");
+    driveQualityRelay = std::make_unique<juce::WebComboBoxRelay>("DRIVE_QUALITY");
+    reverbModeRelay = std::make_unique<juce::WebComboBoxRelay>("REVERB_MODE");
 
     // ------------------------------------------------------------------------
     // STEP 2: CREATE WEBVIEW (with relay options)
@@ -59,6 +62,8 @@ FlutterVerbAudioProcessorEditor::FlutterVerbAudioProcessorEditor(FlutterVerbAudi
             .withOptionsFrom(*driveRelay)
             .withOptionsFrom(*toneRelay)
             .withOptionsFrom(*modModeRelay)
+            .withOptionsFrom(*driveQualityRelay)
+            .withOptionsFrom(*reverbModeRelay)
     );
 
     // ------------------------------------------------------------------------
@@ -103,6 +108,16 @@ FlutterVerbAudioProcessorEditor::FlutterVerbAudioProcessorEditor(FlutterVerbAudi
         *modModeRelay,
         nullptr
     );
+    driveQualityAttachment = std::make_unique<juce::WebComboBoxParameterAttachment>(
+        *audioProcessor.getAPVTS().getParameter("DRIVE_QUALITY"),
+        *driveQualityRelay,
+        nullptr
+    );
+    reverbModeAttachment = std::make_unique<juce::WebComboBoxParameterAttachment>(
+        *audioProcessor.getAPVTS().getParameter("REVERB_MODE"),
+        *reverbModeRelay,
+        nullptr
+    );
 
     // ------------------------------------------------------------------------
     // WEBVIEW SETUP
@@ -7,7 +7,7 @@
  * FlutterVerb WebView-based Plugin Editor
  *
  * UI Mockup: v6 (600×640px, TapeAge-inspired design)
- * Parameters: 7 total (SIZE, DECAY, MIX, AGE, DRIVE, TONE, MOD_MODE)
+ * Parameters: 9 total (SIZE, DECAY, MIX, AGE, DRIVE, TONE, MOD_MODE, DRIVE_QUALITY, REVERB_MODE)
  *
  * CRITICAL: Member declaration order prevents release build crashes.
  * Order: Relays → WebView → Attachments
@@ -63,9 +63,11 @@ private:
     // 1️⃣ RELAYS FIRST (created first, destroyed last)
     // ------------------------------------------------------------------------
     //
-    // FlutterVerb has 6 continuous parameters + 1 toggle:
+    // FlutterVerb has 6 continuous parameters + 1 toggle + 2 choices:
     // - SIZE, DECAY, MIX, AGE, DRIVE, TONE (sliders/knobs)
     // - MOD_MODE (toggle: Wet Only / Wet+Dry)
+    // - DRIVE_QUALITY (selector: 1x / 2x / 4x / 8x)
+    // - REVERB_MODE (selector: Classic / FDN)
     //
     std::unique_ptr<juce::WebSliderRelay> sizeRelay;
     std::unique_ptr<juce::WebSliderRelay> decayRelay;
@@ -74,6 +76,8 @@ private:
     std::unique_ptr<juce::WebSliderRelay> driveRelay;
     std::unique_ptr<juce::WebSliderRelay> toneRelay;
     std::unique_ptr<juce::WebToggleButtonRelay> modModeRelay;
+    std::unique_ptr<juce::WebComboBoxRelay> driveQualityRelay;
+    std::unique_ptr<juce::WebComboBoxRelay> reverbModeRelay;
 
     // ------------------------------------------------------------------------
     // 2️⃣ WEBVIEW SECOND (created after relays, destroyed before relays)
@@ -101,5 +105,9 @@ private:
     // 1 toggle attachment (boolean parameter)
     std::unique_ptr<juce::WebToggleButtonParameterAttachment> modModeAttachment;
 
+    // 2 combo box attachments (choice parameters)
+    std::unique_ptr<juce::WebComboBoxParameterAttachment> driveQualityAttachment;
+    std::unique_ptr<juce::WebComboBoxParameterAttachment> reverbModeAttachment;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FlutterVerbAudioProcessorEditor)
 };
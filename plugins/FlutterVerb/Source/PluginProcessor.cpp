@@ -66,6 +66,22 @@ juce::AudioProcessorValueTreeState::ParameterLayout FlutterVerbAudioProcessor::c
         false  // Default: WET ONLY (0)
     ));
 
+    // DRIVE_QUALITY - Saturation oversampling (higher = less aliasing, more CPU and latency)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "DRIVE_QUALITY", 1 },
+        "Drive Quality",
+        OversampledSaturator::getQualityNames(),
+        0  // Default: 1x (no added latency)
+    ));
+
+    // REVERB_MODE - Reverb engine (Classic = Freeverb, FDN = 8-line feedback delay network)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "REVERB_MODE", 1 },
+        "Reverb Mode",
+        juce::StringArray { "Classic", "FDN" },
+        0  // Default: Classic (matches pre-FDN sessions)
+    ));
+
     return layout;
 }
 
@@ -95,28 +111,51 @@ void FlutterVerbAudioProcessor::prepareToPlay(double sampleRate, int samplesPerB
     dryWetMixer.prepare(spec);
     dryWetMixer.reset();
 
-    // Fix 2: Set wet path latency compensation for modulation delay (50ms base delay)
-    float baseDelayMs = 50.0f;
-    int latencySamples = static_cast<int>((baseDelayMs / 1000.0f) * sampleRate);
-    dryWetMixer.setWetLatency(latencySamples);
+    // Wet path latency compensation is set per block from the saturator's oversampling latency.
+    // The 50ms modulation centre delay is left uncompensated (acts as wet pre-delay), as before.
 
     // Prepare reverb with ProcessSpec
     reverb.prepare(spec);
     reverb.reset();
+    fdnReverb.prepare(spec);
+    fdnReverb.reset();
 
     // Phase 4.2: Prepare modulation system
-    modulationDelay.prepare(spec);
+    modulationDelay.prepare(spec, 200.0f); // 200ms max
+    modulationDelay.setLfoRates(1.0f, 6.0f);  // Wow 1Hz, flutter 6Hz
     modulationDelay.reset();
-    modulationDelay.setMaximumDelayInSamples(static_cast<int>(sampleRate * 0.2)); // 200ms max
 
-    // Initialize per-channel LFO phase tracking
-    wowPhase.resize(spec.numChannels, 0.0f);
-    flutterPhase.resize(spec.numChannels, 0.0f);
+    // Phase 4.3: Prepare oversampled saturation
+    driveSaturator.prepare(spec);
+
+    // Resolve the offline boost now: a bounce's latency must be reported before it starts
+    updateDriveQuality();
 
     // Phase 4.3: Prepare filter
     toneFilter.prepare(spec);
     toneFilter.reset();
-    currentFilterType = FilterType::None;
+
+    // Reverb output is continuous, so a short quiet hold is enough to catch an early decay
+    tailTracker.prepare(sampleRate);
+    tailTracker.setQuietHoldSeconds(0.25);
+}
+
+void FlutterVerbAudioProcessor::updateDriveQuality()
+{
+    // Live: the user's choice. Bouncing: at least 4x (latency follows, reported below)
+    renderQuality.update(*this);
+
+    auto* driveQualityParam = parameters.getRawParameterValue("DRIVE_QUALITY");
+    driveSaturator.setQuality(renderQuality.atLeastWhenOffline(static_cast<int>(driveQualityParam->load()), 2));
+
+    // Latency is reported to the host; the dry path only needs compensating when
+    // drive runs on the wet path alone (Mode 0)
+    const bool wetDryMode = parameters.getRawParameterValue("MOD_MODE")->load() > 0.5f;
+    const int saturatorLatency = driveSaturator.getLatencyInSamples();
+    dryWetMixer.setWetLatency(wetDryMode ? 0.0f : static_cast<float>(saturatorLatency));
+
+    if (saturatorLatency != getLatencySamples())
+        setLatencySamples(saturatorLatency);
 }
 
 void FlutterVerbAudioProcessor::releaseResources()
@@ -156,6 +195,20 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     auto* modModeParam = parameters.getRawParameterValue("MOD_MODE");
     bool wetDryMode = modModeParam->load() > 0.5f;  // 0=WET_ONLY, 1=WET_DRY
 
+    // Saturation quality can change at any time (latency follows)
+    updateDriveQuality();
+
+    // Tail: DECAY is the FDN's RT60; the Classic engine only loosely follows it, so
+    // allow headroom, plus the 50ms modulation delay and oversampling filters
+    tailTracker.setTailLengthSeconds(decayValue * 1.5 + 0.25);
+
+    // Idle: input silent and the tail has died away - skip all DSP
+    if (tailTracker.processInput(buffer, getTotalNumInputChannels()))
+    {
+        outputLevel.store(-100.0f, std::memory_order_relaxed);
+        return;
+    }
+
     // Configure reverb parameters with true SIZE/DECAY independence
     juce::Reverb::Parameters reverbParams;
 
@@ -176,8 +229,27 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     reverbParams.wetLevel = 1.0f;      // Full wet (mixer handles blend)
     reverbParams.dryLevel = 0.0f;      // No dry (mixer handles blend)
 
+    // Phase 4.1b: Engine selection
+    auto* reverbModeParam = parameters.getRawParameterValue("REVERB_MODE");
+    int reverbMode = static_cast<int>(reverbModeParam->load());  // 0=Classic, 1=FDN
+
+    if (reverbMode != lastReverbMode)
+    {
+        // Don't resume from a stale tail left over from the last time this engine ran
+        reverb.reset();
+        fdnReverb.reset();
+        lastReverbMode = reverbMode;
+    }
+
     reverb.setParameters(reverbParams);
 
+    // FDN uses DECAY directly as RT60, SIZE scales line lengths
+    FDNReverb::Parameters fdnParams;
+    fdnParams.size = sizeValue;
+    fdnParams.decaySeconds = decayValue;
+    fdnParams.damping = reverbParams.damping;  // Same decay-linked damping curve as Classic
+    fdnReverb.setParameters(fdnParams);
+
     // Set dry/wet mix proportion
     dryWetMixer.setWetMixProportion(mixValue);
 
@@ -188,145 +260,32 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     auto applyModulation = [&]() {
         if (ageValue > 0.0f)  // Only apply modulation if AGE > 0
         {
-            const int numChannels = buffer.getNumChannels();
-            const int numSamples = buffer.getNumSamples();
-
-            // LFO configuration
-            const float wowFreqHz = 1.0f;      // Center frequency: 1Hz (range 0.5-1.5Hz)
-            const float flutterFreqHz = 6.0f;  // Center frequency: 6Hz (range 4-8Hz)
             const float baseDelayMs = 50.0f;   // Base delay: 50ms
             const float maxModDepth = 0.2f;    // ±20% at AGE=100%
 
-            // Calculate phase increments (radians per sample)
-            const float wowPhaseInc = (wowFreqHz * 2.0f * juce::MathConstants<float>::pi) / static_cast<float>(currentSampleRate);
-            const float flutterPhaseInc = (flutterFreqHz * 2.0f * juce::MathConstants<float>::pi) / static_cast<float>(currentSampleRate);
-
-            // Process each channel
-            for (int channel = 0; channel < numChannels; ++channel)
-            {
-                auto* channelData = buffer.getWritePointer(channel);
-
-                for (int sample = 0; sample < numSamples; ++sample)
-                {
-                    // Calculate wow LFO output (sine wave)
-                    float wowOutput = std::sin(wowPhase[channel]);
-
-                    // Calculate flutter LFO output (sine wave)
-                    float flutterOutput = std::sin(flutterPhase[channel]);
-
-                    // Combine modulation signals (both contribute to pitch variation)
-                    float totalModulation = (wowOutput + flutterOutput) * 0.5f;  // Average to keep in ±1.0 range
-
-                    // Fix 3: Scale by AGE parameter with exponential curve for more usable range
-                    // Exponential scaling gives more control in 0-50% range, still reaches extremes at 100%
-                    float scaledAge = ageValue * ageValue;  // Exponential response
-                    totalModulation *= scaledAge;
-
-                    // Calculate modulated delay time in samples
-                    float baseDelaySamples = (baseDelayMs / 1000.0f) * static_cast<float>(currentSampleRate);
-                    float modulationAmount = baseDelaySamples * maxModDepth * totalModulation;  // ±20% depth
-                    float delayTimeSamples = baseDelaySamples + modulationAmount;
-
-                    // Ensure delay time is within valid range
-                    delayTimeSamples = juce::jlimit(1.0f, static_cast<float>(currentSampleRate * 0.2), delayTimeSamples);
-
-                    // Set delay time for this channel
-                    modulationDelay.setDelay(static_cast<float>(delayTimeSamples));
+            // Fix 3: Scale by AGE parameter with exponential curve for more usable range
+            // Exponential scaling gives more control in 0-50% range, still reaches extremes at 100%
+            float scaledAge = ageValue * ageValue;  // Exponential response
 
-                    // Process sample through delay line
-                    modulationDelay.pushSample(channel, channelData[sample]);
-                    channelData[sample] = modulationDelay.popSample(channel);
-
-                    // Update LFO phases with wrapping
-                    wowPhase[channel] += wowPhaseInc;
-                    if (wowPhase[channel] >= 2.0f * juce::MathConstants<float>::pi)
-                        wowPhase[channel] -= 2.0f * juce::MathConstants<float>::pi;
-
-                    flutterPhase[channel] += flutterPhaseInc;
-                    if (flutterPhase[channel] >= 2.0f * juce::MathConstants<float>::pi)
-                        flutterPhase[channel] -= 2.0f * juce::MathConstants<float>::pi;
-                }
-            }
+            modulationDelay.process(buffer, baseDelayMs, maxModDepth * scaledAge);
         }
     };
 
     // Define DRIVE processing lambda for reusability
     auto applyDrive = [&]() {
-        if (driveValue > 0.0f)  // Only apply if DRIVE > 0
-        {
-            // Calculate gain: 1.0 at DRIVE=0%, 10.0 at DRIVE=100%
-            float gain = 1.0f + (driveValue * 9.0f);
-
-            const int numChannels = buffer.getNumChannels();
-            const int numSamples = buffer.getNumSamples();
-
-            for (int channel = 0; channel < numChannels; ++channel)
-            {
-                auto* channelData = buffer.getWritePointer(channel);
-
-                for (int sample = 0; sample < numSamples; ++sample)
-                {
-                    // Apply tanh saturation
-                    channelData[sample] = std::tanh(gain * channelData[sample]);
-                }
-            }
-        }
+        // Calculate gain: 1.0 at DRIVE=0%, 10.0 at DRIVE=100%
+        float gain = 1.0f + (driveValue * 9.0f);
+
+        // Oversampled tanh saturation; at DRIVE=0% the signal still passes the
+        // oversampling filters so latency doesn't jump with the knob
+        driveSaturator.process(block, gain, driveValue > 0.0f);
     };
 
     // Define TONE filter lambda for reusability
     auto applyToneFilter = [&]() {
-        if (std::abs(toneValue) > 0.5f)  // Bypass zone: |TONE| <= 0.5%
-        {
-            float sampleRate = static_cast<float>(currentSampleRate);
-            bool isLowPass = (toneValue < 0.0f);
-
-            // Determine filter type and reset state if type changed
-            FilterType newFilterType = isLowPass ? FilterType::LowPass : FilterType::HighPass;
-            if (newFilterType != currentFilterType)
-            {
-                toneFilter.reset();  // Prevent burst artifacts on type transition
-                currentFilterType = newFilterType;
-            }
-
-            if (isLowPass)
-            {
-                // Low-pass filter (negative values: -100% to 0%)
-                // Exponential mapping: 200Hz (extreme) to 20kHz (center)
-                float normalizedValue = std::abs(toneValue) / 100.0f;  // 0.0 to 1.0
-                float cutoffHz = 20000.0f * std::pow(10.0f, -normalizedValue * std::log10(100.0f));
-                cutoffHz = juce::jlimit(200.0f, 20000.0f, cutoffHz);
-
-                *toneFilter.state = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                    sampleRate, cutoffHz, 0.707f  // Q = 0.707 (Butterworth)
-                );
-            }
-            else
-            {
-                // High-pass filter (positive values: 0% to +100%)
-                // Exponential mapping: 20Hz (center) to 10kHz (extreme)
-                float normalizedValue = toneValue / 100.0f;  // 0.0 to 1.0
-                float cutoffHz = 20.0f * std::pow(10.0f, normalizedValue * std::log10(500.0f));
-                cutoffHz = juce::jlimit(20.0f, 10000.0f, cutoffHz);
-
-                *toneFilter.state = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-                    sampleRate, cutoffHz, 0.707f  // Q = 0.707 (Butterworth)
-                );
-            }
-
-            // Process buffer through filter
-            juce::dsp::AudioBlock<float> filterBlock(buffer);
-            juce::dsp::ProcessContextReplacing<float> filterContext(filterBlock);
-            toneFilter.process(filterContext);
-        }
-        else
-        {
-            // Reset filter state when entering bypass zone
-            if (currentFilterType != FilterType::None)
-            {
-                toneFilter.reset();
-                currentFilterType = FilterType::None;
-            }
-        }
+        // LP below 0, HP above 0, bypass zone |TONE| <= 0.5% (handled by DJFilter)
+        toneFilter.setFilterAmount(toneValue);
+        toneFilter.process(juce::dsp::AudioBlock<float>(buffer));
     };
 
     // Phase 4.4: MOD_MODE Routing with correct DRIVE/TONE positioning
@@ -343,7 +302,10 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
 
     // Process reverb using modern DSP API
     juce::dsp::ProcessContextReplacing<float> context(block);
-    reverb.process(context);
+    if (reverbMode == 1)
+        fdnReverb.process(context);
+    else
+        reverb.process(context);
 
     if (!wetDryMode)
     {
@@ -373,6 +335,8 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
         ? juce::Decibels::gainToDecibels(peakLevel)
         : -100.0f;
     outputLevel.store(peakDb, std::memory_order_relaxed);
+
+    tailTracker.processOutput(buffer);
 }
 
 juce::AudioProcessorEditor* FlutterVerbAudioProcessor::createEditor()
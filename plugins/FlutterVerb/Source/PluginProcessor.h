@@ -1,6 +1,12 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "FDNReverb.h"
+#include "ModulatedDelay.h"
+#include "DJFilter.h"
+#include "OversampledSaturator.h"
+#include "TailTracker.h"
+#include "RenderQuality.h"
 
 class FlutterVerbAudioProcessor : public juce::AudioProcessor
 {
@@ -19,7 +25,7 @@ public:
     bool acceptsMidi() const override { return false; }
     bool producesMidi() const override { return false; }
     bool isMidiEffect() const override { return false; }
-    double getTailLengthSeconds() const override { return 0.0; }
+    double getTailLengthSeconds() const override { return tailTracker.getTailLengthSeconds(); }
 
     int getNumPrograms() override { return 1; }
     int getCurrentProgram() override { return 0; }
@@ -39,18 +45,26 @@ private:
 
     // Phase 4.1: Core Reverb Processing
     juce::dsp::Reverb reverb;
-    juce::dsp::DryWetMixer<float> dryWetMixer;
+    FDNReverb fdnReverb;                // REVERB_MODE = FDN
+    int lastReverbMode = -1;            // Reset the engine being switched to
+    juce::dsp::DryWetMixer<float> dryWetMixer { 1024 };  // Room for saturator latency compensation
 
     // Phase 4.2: Modulation System
-    juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> modulationDelay { 9600 }; // 200ms at 48kHz
-    std::vector<float> wowPhase;    // Per-channel wow LFO phase (0-2π)
-    std::vector<float> flutterPhase; // Per-channel flutter LFO phase (0-2π)
+    ModulatedDelay modulationDelay;     // Block-based wow/flutter (phasor LFOs, const Lagrange taps)
     double currentSampleRate = 44100.0; // Store sample rate for LFO calculations
 
     // Phase 4.3: Saturation and Filter
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> toneFilter;
-    enum class FilterType { None, LowPass, HighPass };
-    FilterType currentFilterType = FilterType::None;
+    OversampledSaturator driveSaturator;  // DRIVE_QUALITY selects 1x-8x
+    DJFilter toneFilter;  // Shared allocation-free bipolar LP/HP filter
+
+    // Tail length for the host + idle bypass once input and tail are silent
+    TailTracker tailTracker;
+
+    // Offline bounces run the saturator at 4x or more
+    RenderQuality renderQuality;
+
+    // Applies DRIVE_QUALITY (boosted offline) and keeps mixer/host latency in sync
+    void updateDriveQuality();
 
     // APVTS comes AFTER DSP components
     juce::AudioProcessorValueTreeState parameters;
@@ -82,52 +82,10 @@ void GainKnobAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
     auto* filterParam = parameters.getRawParameterValue("FILTER");
     float filterPercent = filterParam->load();
 
-    // Apply DJ-style filter (if not at center position)
-    if (std::abs(filterPercent) > 0.5f) {
-        float sampleRate = static_cast<float>(getSampleRate());
-        bool isLowPass = (filterPercent < 0.0f);
-
-        // Reset filter state when switching between low-pass and high-pass
-        // Prevents burst caused by residual energy in delay buffers
-        if (isLowPass != previousWasLowPass) {
-            filterProcessor.reset();
-        }
-        previousWasLowPass = isLowPass;
-
-        if (isLowPass) {
-            // Low-pass filter (negative values)
-            // Exponential mapping: -100% = 200Hz (heavy bass), 0% = 20kHz (bypass)
-            // Formula inverted: Start high at center, go low at extreme
-            float normalizedValue = std::abs(filterPercent) / 100.0f; // 0.0 to 1.0
-            float cutoffHz = 20000.0f * std::pow(10.0f, -normalizedValue * std::log10(20000.0f / 200.0f));
-
-            *filterProcessor.state = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                sampleRate, juce::jlimit(200.0f, 20000.0f, cutoffHz), 0.707f
-            );
-        } else {
-            // High-pass filter (positive values)
-            // Exponential mapping: 0% = 20Hz (bypass), +100% = 10kHz (heavy treble)
-            // Formula: Start low at center, go high at extreme
-            float normalizedValue = filterPercent / 100.0f; // 0.0 to 1.0
-            float cutoffHz = 20.0f * std::pow(10.0f, normalizedValue * std::log10(10000.0f / 20.0f));
-
-            *filterProcessor.state = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-                sampleRate, juce::jlimit(20.0f, 10000.0f, cutoffHz), 0.707f
-            );
-        }
-
-        // Process buffer through filter
-        juce::dsp::AudioBlock<float> block(buffer);
-        juce::dsp::ProcessContextReplacing<float> context(block);
-        filterProcessor.process(context);
-    } else {
-        // Reset filter state when entering bypass zone
-        // Prevents residual energy when re-entering filter range
-        if (previousWasLowPass) {
-            filterProcessor.reset();
-            previousWasLowPass = false;
-        }
-    }
+    // Apply DJ-style filter (bypassed at center position)
+    // Negative = low-pass (20kHz → 200Hz), positive = high-pass (20Hz → 10kHz)
+    filterProcessor.setFilterAmount(filterPercent);
+    filterProcessor.process(juce::dsp::AudioBlock<float>(buffer));
 
     // Convert dB to linear gain multiplier
     float gainLinear;
@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "DJFilter.h"
 
 class GainKnobAudioProcessor : public juce::AudioProcessor
 {
@@ -37,10 +38,7 @@ private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
     // Filter state (per-channel)
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> filterProcessor;
-
-    // Track previous filter type to detect transitions
-    bool previousWasLowPass = false;
+    DJFilter filterProcessor;  // Shared allocation-free bipolar LP/HP filter
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GainKnobAudioProcessor)
 };
@@ -0,0 +1,41 @@
+#pragma once
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "ChokeGroups.h"
+#include "HiHatVoice.h"
+
+class HiHatSynthesiser : public juce::Synthesiser
+{
+public:
+    static constexpr int closedHatNote = 36;  // C1
+    static constexpr int openHatNote = 38;    // D1
+    static constexpr int openHatGroup = 0;
+
+    HiHatSynthesiser()
+    {
+        // Closed hi-hat cuts open hi-hat (Phase 4.3)
+        chokeGroups.setNoteGroup(openHatNote, openHatGroup);
+        chokeGroups.setNoteChokesGroup(closedHatNote, openHatGroup);
+
+        // Split rendering at every MIDI event so chokes and onsets are sample-accurate
+        setMinimumRenderingSubdivisionSize(1);
+    }
+
+    ChokeGroups& getChokeGroups() { return chokeGroups; }
+
+    void noteOn(int midiChannel, int midiNoteNumber, float velocity) override
+    {
+        // Called between sub-blocks at the event's own timestamp
+        chokeGroups.noteOn(midiNoteNumber, [this](int voiceIndex)
+        {
+            auto* voice = static_cast<HiHatVoice*>(voices.getUnchecked(voiceIndex));
+
+            if (voice->isVoiceActive())
+                voice->forceRelease();
+        });
+
+        juce::Synthesiser::noteOn(midiChannel, midiNoteNumber, velocity);
+    }
+
+private:
+    ChokeGroups chokeGroups;
+};
@@ -1,7 +1,9 @@
 #include "HiHatVoice.h"
 
-HiHatVoice::HiHatVoice(juce::AudioProcessorValueTreeState& apvts)
+HiHatVoice::HiHatVoice(juce::AudioProcessorValueTreeState& apvts, ChokeGroups& groups, int index)
     : parameters(apvts)
+    , chokeGroups(groups)
+    , voiceIndex(index)
 {
 }
 
@@ -19,18 +21,20 @@ void HiHatVoice::prepareToPlay(double sampleRate, int samplesPerBlock)
     toneFilter.reset();
     noiseColorFilter.reset();
 
+    // 20ms cutoff glide removes zipper noise when tone/color are automated
+    toneCutoff.reset(sampleRate, 0.02);
+    colorCutoff.reset(sampleRate, 0.02);
+    toneCutoff.setCurrentAndTargetValue(3000.0f);
+    colorCutoff.setCurrentAndTargetValue(5000.0f);
+
     // Initialize resonators (Phase 4.3) - Fixed peaks at 7kHz, 10kHz, 13kHz
     const std::array<float, 3> peakFreqs = {7000.0f, 10000.0f, 13000.0f};
     const float Q = 4.0f;  // Moderate resonance for organic body
     const float gainDB = -6.0f;  // Subtle enhancement
 
-    for (int i = 0; i < 3; ++i)
-    {
-        resonators[i].prepare(spec);
-        *resonators[i].coefficients = *juce::dsp::IIR::Coefficients<float>::makePeakFilter(
-            sampleRate, peakFreqs[i], Q, juce::Decibels::decibelsToGain(gainDB));
-        resonators[i].reset();
-    }
+    resonators.prepare(sampleRate, peakFreqs, Q, juce::Decibels::decibelsToGain(gainDB));
+
+    monoScratch.setSize(1, samplesPerBlock);
 }
 
 bool HiHatVoice::canPlaySound(juce::SynthesiserSound* sound)
@@ -47,6 +51,16 @@ void HiHatVoice::startNote(int midiNoteNumber, float velocity,
     // Store velocity as linear gain (0.0-1.0)
     velocityGain = velocity;
 
+    // Jump straight to this note's cutoffs (no glide from the previous note)
+    updateFilterTargets(true);
+
+    // Stereo spread: random constant-power pan per hit, normalised so centre = unity
+    float spread = parameters.getRawParameterValue("STEREO_SPREAD")->load() / 100.0f;
+    float pan = spread * (noiseGenerator.nextFloat() * 2.0f - 1.0f);  // -1 (L) to +1 (R)
+    float panAngle = (pan + 1.0f) * juce::MathConstants<float>::pi * 0.25f;
+    leftGain = std::cos(panAngle) * juce::MathConstants<float>::sqrt2;
+    rightGain = std::sin(panAngle) * juce::MathConstants<float>::sqrt2;
+
     // Configure ADSR based on note type
     if (isClosed)
     {
@@ -79,6 +93,9 @@ void HiHatVoice::startNote(int midiNoteNumber, float velocity,
         envelope.setParameters(adsrParams);
     }
 
+    // Open hats join the choke group, closed hats leave it
+    chokeGroups.voiceStarted(voiceIndex, midiNoteNumber);
+
     // Trigger envelope
     envelope.noteOn();
 }
@@ -94,6 +111,7 @@ void HiHatVoice::stopNote(float, bool allowTailOff)
         // Immediate cutoff
         clearCurrentNote();
         envelope.reset();
+        chokeGroups.voiceStopped(voiceIndex);
     }
 }
 
@@ -104,12 +122,8 @@ void HiHatVoice::forceRelease()
     envelope.noteOff();
 }
 
-void HiHatVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer,
-                                 int startSample, int numSamples)
+void HiHatVoice::updateFilterTargets(bool snapToTarget)
 {
-    if (!isVoiceActive())
-        return;
-
     // Read parameters once per block (atomic reads)
     const char* toneParamID = isClosed ? "CLOSED_TONE" : "OPEN_TONE";
     const char* colorParamID = isClosed ? "CLOSED_NOISE_COLOR" : "OPEN_NOISE_COLOR";
@@ -117,81 +131,126 @@ void HiHatVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer,
     float toneValue = parameters.getRawParameterValue(toneParamID)->load() / 100.0f;  // Normalize to 0.0-1.0
     float colorValue = parameters.getRawParameterValue(colorParamID)->load() / 100.0f;
 
-    for (int sample = 0; sample < numSamples; ++sample)
+    // SVF cutoff must stay below Nyquist
+    const float maxCutoff = juce::jmin(20000.0f, static_cast<float>(currentSampleRate * 0.45));
+
+    // Tone Filter (brightness control)
+    // Exponential frequency mapping: 3kHz-15kHz
+    float velocityToneMod = velocityGain * 0.3f;  // Up to +30% cutoff modulation
+    float baseFreq = 3000.0f * std::pow(5.0f, toneValue);
+    float finalCutoff = baseFreq * (1.0f + velocityToneMod);
+    finalCutoff = juce::jlimit(20.0f, maxCutoff, finalCutoff);
+
+    // LP below 50%, HP above 50%
+    toneFilter.setType(toneValue < 0.5f ? juce::dsp::StateVariableTPTFilterType::lowpass
+                                         : juce::dsp::StateVariableTPTFilterType::highpass);
+
+    // Noise Color Filter (warmth control)
+    // Bypass zone at 50% ±2%
+    colorFilterActive = std::abs(colorValue - 0.5f) > 0.02f;
+
+    if (colorFilterActive)
     {
-        // 1. Generate white noise: range [-1.0, 1.0]
-        float noiseSample = (noiseGenerator.nextFloat() * 2.0f) - 1.0f;
-
-        // 2. Apply Tone Filter (brightness control)
-        // Exponential frequency mapping: 3kHz-15kHz
-        float velocityToneMod = velocityGain * 0.3f;  // Up to +30% cutoff modulation
-        float baseFreq = 3000.0f * std::pow(5.0f, toneValue);
-        float finalCutoff = baseFreq * (1.0f + velocityToneMod);
-        finalCutoff = juce::jlimit(20.0f, 20000.0f, finalCutoff);
-
-        // Update Tone Filter coefficients (LP below 50%, HP above 50%)
-        if (toneValue < 0.5f)
-        {
-            *toneFilter.coefficients = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                currentSampleRate, finalCutoff, 0.707f);
-        }
+        // Exponential frequency mapping: 5kHz-10kHz
+        float colorFreq = 5000.0f * std::pow(2.0f, (colorValue - 0.5f) * 2.0f);
+        colorFreq = juce::jlimit(20.0f, maxCutoff, colorFreq);
+
+        noiseColorFilter.setType(colorValue < 0.5f ? juce::dsp::StateVariableTPTFilterType::lowpass
+                                                   : juce::dsp::StateVariableTPTFilterType::highpass);
+
+        if (snapToTarget)
+            colorCutoff.setCurrentAndTargetValue(colorFreq);
         else
-        {
-            *toneFilter.coefficients = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-                currentSampleRate, finalCutoff, 0.707f);
-        }
+            colorCutoff.setTargetValue(colorFreq);
+    }
+
+    if (snapToTarget)
+    {
+        toneCutoff.setCurrentAndTargetValue(finalCutoff);
+        toneFilter.setCutoffFrequency(toneCutoff.getCurrentValue());
+        noiseColorFilter.setCutoffFrequency(colorCutoff.getCurrentValue());
+    }
+    else
+    {
+        toneCutoff.setTargetValue(finalCutoff);
+    }
+}
 
-        // Process through Tone Filter
-        noiseSample = toneFilter.processSample(noiseSample);
+void HiHatVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer,
+                                 int startSample, int numSamples)
+{
+    if (!isVoiceActive() || monoScratch.getNumSamples() == 0)
+        return;
 
-        // 3. Apply Noise Color Filter (warmth control)
-        // Bypass zone at 50% ±2%
-        if (std::abs(colorValue - 0.5f) > 0.02f)
-        {
-            // Exponential frequency mapping: 5kHz-10kHz
-            float colorFreq = 5000.0f * std::pow(2.0f, (colorValue - 0.5f) * 2.0f);
-            colorFreq = juce::jlimit(20.0f, 20000.0f, colorFreq);
+    // Filter targets change at most once per block
+    updateFilterTargets(false);
 
-            // Update Noise Color Filter coefficients (LP below 50%, HP above 50%)
-            if (colorValue < 0.5f)
-            {
-                *noiseColorFilter.coefficients = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                    currentSampleRate, colorFreq, 0.707f);
-            }
-            else
-            {
-                *noiseColorFilter.coefficients = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-                    currentSampleRate, colorFreq, 0.707f);
-            }
+    const int numChannels = outputBuffer.getNumChannels();
+    float* scratch = monoScratch.getWritePointer(0);
 
-            // Process through Noise Color Filter
-            noiseSample = noiseColorFilter.processSample(noiseSample);
-        }
-        // else: bypass (no filtering at 50%)
+    // Hosts may exceed the prepared block size, so render in scratch-sized chunks
+    while (numSamples > 0 && isVoiceActive())
+    {
+        const int chunkSize = juce::jmin(numSamples, monoScratch.getNumSamples());
+        const int numRendered = renderMono(scratch, chunkSize);
 
-        // 4. Apply resonators (Phase 4.3) - Fixed peaks for organic body
-        for (auto& resonator : resonators)
+        // Add to output buffer (don't replace - multiple voices may be active)
+        for (int channel = 0; channel < numChannels; ++channel)
         {
-            noiseSample = resonator.processSample(noiseSample);
+            const float channelGain = (numChannels == 2) ? (channel == 0 ? leftGain : rightGain) : 1.0f;
+            juce::FloatVectorOperations::addWithMultiply(outputBuffer.getWritePointer(channel, startSample),
+                                                         scratch, channelGain, numRendered);
         }
 
-        // 5. Apply envelope
-        float envelopeSample = envelope.getNextSample();
+        startSample += chunkSize;
+        numSamples -= chunkSize;
+    }
+}
+
+int HiHatVoice::renderMono(float* dest, int numSamples)
+{
+    for (int blockStart = 0; blockStart < numSamples; blockStart += controlRateInterval)
+    {
+        const int blockEnd = juce::jmin(numSamples, blockStart + controlRateInterval);
 
-        // 6. Apply velocity scaling
-        float outputSample = noiseSample * envelopeSample * velocityGain;
+        // Control-rate coefficient update (only while a cutoff is still gliding)
+        if (toneCutoff.isSmoothing())
+            toneFilter.setCutoffFrequency(toneCutoff.skip(blockEnd - blockStart));
 
-        // 7. Add to output buffer (don't replace - multiple voices may be active)
-        for (int channel = 0; channel < outputBuffer.getNumChannels(); ++channel)
-        {
-            outputBuffer.addSample(channel, startSample + sample, outputSample);
-        }
+        if (colorCutoff.isSmoothing())
+            noiseColorFilter.setCutoffFrequency(colorCutoff.skip(blockEnd - blockStart));
 
-        // Stop voice if envelope finished
-        if (!envelope.isActive())
+        for (int sample = blockStart; sample < blockEnd; ++sample)
         {
-            clearCurrentNote();
-            break;
+            // 1. Generate white noise: range [-1.0, 1.0]
+            float noiseSample = (noiseGenerator.nextFloat() * 2.0f) - 1.0f;
+
+            // 2. Apply Tone Filter (brightness control)
+            noiseSample = toneFilter.processSample(0, noiseSample);
+
+            // 3. Apply Noise Color Filter (warmth control)
+            if (colorFilterActive)
+                noiseSample = noiseColorFilter.processSample(0, noiseSample);
+            // else: bypass (no filtering at 50%)
+
+            // 4. Apply resonators (Phase 4.3) - Fixed peaks for organic body
+            noiseSample = resonators.processSample(noiseSample);
+
+            // 5. Apply envelope
+            float envelopeSample = envelope.getNextSample();
+
+            // 6. Apply velocity scaling
+            dest[sample] = noiseSample * envelopeSample * velocityGain;
+
+            // Stop voice if envelope finished
+            if (!envelope.isActive())
+            {
+                clearCurrentNote();
+                chokeGroups.voiceStopped(voiceIndex);
+                return sample + 1;
+            }
         }
     }
+
+    return numSamples;
 }
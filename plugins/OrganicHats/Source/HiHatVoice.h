@@ -2,11 +2,13 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include "HiHatSound.h"
+#include "ResonatorBank.h"
+#include "ChokeGroups.h"
 
 class HiHatVoice : public juce::SynthesiserVoice
 {
 public:
-    HiHatVoice(juce::AudioProcessorValueTreeState& apvts);
+    HiHatVoice(juce::AudioProcessorValueTreeState& apvts, ChokeGroups& chokeGroups, int voiceIndex);
 
     bool canPlaySound(juce::SynthesiserSound* sound) override;
 
@@ -26,21 +28,46 @@ public:
 private:
     juce::AudioProcessorValueTreeState& parameters;
 
+    // Choke group membership (registered on note start, by voice index)
+    ChokeGroups& chokeGroups;
+    const int voiceIndex;
+
     // Noise generation
     juce::Random noiseGenerator;
 
     // Envelope shaping
     juce::ADSR envelope;
 
-    // Filtering (Phase 4.2)
-    juce::dsp::IIR::Filter<float> toneFilter;
-    juce::dsp::IIR::Filter<float> noiseColorFilter;
+    // Filtering (Phase 4.2) - TPT state variable filters are allocation-free and
+    // stay stable when the cutoff moves, so LP/HP switching needs no new coefficients
+    juce::dsp::StateVariableTPTFilter<float> toneFilter;
+    juce::dsp::StateVariableTPTFilter<float> noiseColorFilter;
+
+    // Smoothed cutoffs, applied to the filters at control rate
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> toneCutoff;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> colorCutoff;
+    bool colorFilterActive = false;
+
+    static constexpr int controlRateInterval = 32;  // Samples between coefficient updates
+
+    void updateFilterTargets(bool snapToTarget);
 
-    // Resonators (Phase 4.3) - Fixed peaks for organic body
-    std::array<juce::dsp::IIR::Filter<float>, 3> resonators;
+    // Renders up to numSamples mono samples into dest, returns how many were
+    // written (fewer if the envelope finished)
+    int renderMono(float* dest, int numSamples);
+
+    // Resonators (Phase 4.3) - Fixed peaks for organic body, one SIMD lane each
+    ResonatorBank resonators;
 
     double currentSampleRate = 44100.0;
 
+    // Mono render scratch, fanned out to the output channels once per block
+    juce::AudioBuffer<float> monoScratch;
+
+    // Per-voice stereo placement (unity gains = centred)
+    float leftGain = 1.0f;
+    float rightGain = 1.0f;
+
     // Voice state
     bool isClosed = true;  // C1 = closed, D1 = open
     float velocityGain = 1.0f;
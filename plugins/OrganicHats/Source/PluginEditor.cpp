@@ -14,6 +14,7 @@ OrganicHatsAudioProcessorEditor::OrganicHatsAudioProcessorEditor(OrganicHatsAudi
     openToneRelay = std::make_unique<juce::WebSliderRelay>("OPEN_TONE");
     openReleaseRelay = std::make_unique<juce::WebSliderRelay>("OPEN_RELEASE");
     openNoiseColorRelay = std::make_unique<juce::WebSliderRelay>("OPEN_NOISE_COLOR");
+    stereoSpreadRelay = std::make_unique<juce::WebSliderRelay>("STEREO_SPREAD");
 
     // Step 2: Create WebView with resource provider and relay options
     webView = std::make_unique<juce::WebBrowserComponent>(
@@ -27,6 +28,7 @@ OrganicHatsAudioProcessorEditor::OrganicHatsAudioProcessorEditor(OrganicHatsAudi
             .withOptionsFrom(*openToneRelay)
             .withOptionsFrom(*openReleaseRelay)
             .withOptionsFrom(*openNoiseColorRelay)
+            .withOptionsFrom(*stereoSpreadRelay)
     );
 
     addAndMakeVisible(*webView);
@@ -69,6 +71,12 @@ OrganicHatsAudioProcessorEditor::OrganicHatsAudioProcessorEditor(OrganicHatsAudi
         nullptr
     );
 
+    stereoSpreadAttachment = std::make_unique<juce::WebSliderParameterAttachment>(
+        *processorRef.parameters.getParameter("STEREO_SPREAD"),
+        *stereoSpreadRelay,
+        nullptr
+    );
+
     // Set window size (from mockup v2)
     setSize(600, 590);
     setResizable(false, false);
@@ -39,6 +39,7 @@ private:
     std::unique_ptr<juce::WebSliderRelay> openToneRelay;
     std::unique_ptr<juce::WebSliderRelay> openReleaseRelay;
     std::unique_ptr<juce::WebSliderRelay> openNoiseColorRelay;
+    std::unique_ptr<juce::WebSliderRelay> stereoSpreadRelay;
 
     // WebView component
     std::unique_ptr<juce::WebBrowserComponent> webView;
@@ -50,6 +51,7 @@ private:
     std::unique_ptr<juce::WebSliderParameterAttachment> openToneAttachment;
     std::unique_ptr<juce::WebSliderParameterAttachment> openReleaseAttachment;
     std::unique_ptr<juce::WebSliderParameterAttachment> openNoiseColorAttachment;
+    std::unique_ptr<juce::WebSliderParameterAttachment> stereoSpreadAttachment;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OrganicHatsAudioProcessorEditor)
 };
@@ -10,7 +10,7 @@ OrganicHatsAudioProcessor::OrganicHatsAudioProcessor()
 {
     // Add 16 voices for polyphony (8 closed + 8 open typical use)
     for (int i = 0; i < 16; ++i)
-        synth.addVoice(new HiHatVoice(parameters));
+        synth.addVoice(new HiHatVoice(parameters, synth.getChokeGroups(), i));
 
     // Add hi-hat sound descriptor
     synth.addSound(new HiHatSound());
@@ -70,6 +70,15 @@ juce::AudioProcessorValueTreeState::ParameterLayout OrganicHatsAudioProcessor::c
         "%"
     ));
 
+    // Shared
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID { "STEREO_SPREAD", 1 },
+        "Stereo Spread",
+        juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f),
+        0.0f,
+        "%"
+    ));
+
     return layout;
 }
 
@@ -102,32 +111,8 @@ void OrganicHatsAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     // Clear output buffer before synthesiser adds to it
     buffer.clear();
 
-    // Implement choke logic (Phase 4.3): Closed hi-hat cuts open hi-hat
-    for (const auto metadata : midiMessages)
-    {
-        const auto msg = metadata.getMessage();
-        if (msg.isNoteOn())
-        {
-            int noteNumber = msg.getNoteNumber();
-
-            // If closed hi-hat (C1 = 36), choke all active open hi-hats
-            if (noteNumber == 36)
-            {
-                for (int i = 0; i < synth.getNumVoices(); ++i)
-                {
-                    if (auto* voice = dynamic_cast<HiHatVoice*>(synth.getVoice(i)))
-                    {
-                        if (voice->isOpen() && voice->isVoiceActive())
-                        {
-                            voice->forceRelease();
-                        }
-                    }
-                }
-            }
-        }
-    }
-
     // Render MIDI-triggered hi-hat voices
+    // Choke logic (Phase 4.3) runs inside HiHatSynthesiser::noteOn at each event's timestamp
     synth.renderNextBlock(buffer, midiMessages, 0, buffer.getNumSamples());
 }
 
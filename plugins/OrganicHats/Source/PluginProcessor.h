@@ -1,5 +1,6 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
+#include "HiHatSynthesiser.h"
 
 class OrganicHatsAudioProcessor : public juce::AudioProcessor
 {
@@ -34,8 +35,8 @@ public:
 private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
-    // Synthesiser for hi-hat voice management
-    juce::Synthesiser synth;
+    // Synthesiser for hi-hat voice management (applies choke groups per event)
+    HiHatSynthesiser synth;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OrganicHatsAudioProcessor)
 };
@@ -0,0 +1,70 @@
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+
+// Three serial peak resonators evaluated as one SIMD biquad.
+//
+// Each resonator occupies one SIMD lane. The cascade is software-pipelined:
+// on every sample lane k processes the output lane k-1 produced on the
+// previous sample, so all stages run in a single vector multiply-add pass.
+// The price is (numResonators - 1) samples of latency, which is inaudible
+// on a noise source.
+class ResonatorBank
+{
+public:
+    static constexpr int numResonators = 3;
+
+    using Vec = juce::dsp::SIMDRegister<float>;
+    static_assert(Vec::SIMDNumElements >= numResonators, "Resonators must fit in one SIMD register");
+
+    void prepare(double sampleRate, const std::array<float, numResonators>& peakFreqs, float Q, float gain)
+    {
+        // Unused lanes keep zero coefficients (silent, denormal-free)
+        b0 = b1 = b2 = a1 = a2 = Vec::expand(0.0f);
+
+        for (int i = 0; i < numResonators; ++i)
+        {
+            auto coeffs = juce::dsp::IIR::Coefficients<float>::makePeakFilter(sampleRate, peakFreqs[(size_t) i], Q, gain);
+            const auto* c = coeffs->getRawCoefficients();  // b0, b1, b2, a1, a2 (normalised by a0)
+
+            b0.set((size_t) i, c[0]);
+            b1.set((size_t) i, c[1]);
+            b2.set((size_t) i, c[2]);
+            a1.set((size_t) i, c[3]);
+            a2.set((size_t) i, c[4]);
+        }
+
+        reset();
+    }
+
+    void reset()
+    {
+        s1 = s2 = Vec::expand(0.0f);
+        std::fill(std::begin(laneInputs), std::end(laneInputs), 0.0f);
+        std::fill(std::begin(laneOutputs), std::end(laneOutputs), 0.0f);
+    }
+
+    float processSample(float input) noexcept
+    {
+        laneInputs[0] = input;
+
+        // Transposed direct form II, all stages at once
+        const auto x = Vec::fromRawArray(laneInputs);
+        const auto y = b0 * x + s1;
+        s1 = b1 * x - a1 * y + s2;
+        s2 = b2 * x - a2 * y;
+        y.copyToRawArray(laneOutputs);
+
+        // Each stage feeds the next one on the following sample
+        for (int lane = numResonators - 1; lane > 0; --lane)
+            laneInputs[lane] = laneOutputs[lane - 1];
+
+        return laneOutputs[numResonators - 1];
+    }
+
+private:
+    Vec b0, b1, b2, a1, a2;
+    Vec s1, s2;
+
+    alignas(sizeof(Vec)) float laneInputs[Vec::SIMDNumElements] {};
+    alignas(sizeof(Vec)) float laneOutputs[Vec::SIMDNumElements] {};
+};
@@ -127,6 +127,11 @@ void ScatterAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     feedbackBuffer.setSize(2, samplesPerBlock);
     feedbackBuffer.clear();
 
+    // Grains can replay anything still in the 2s delay buffer, so the output may
+    // be quiet for that long while audio is still pending
+    tailTracker.prepare(sampleRate);
+    tailTracker.setQuietHoldSeconds(2.0);
+
     // Initialize grain scheduler
     grainSpawnCounter = 0;
     lastGrainSpawnInterval = 0;
@@ -140,7 +145,12 @@ void ScatterAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
         grain.grainSizeSamples = 0;
         grain.pan = 0.5f;
         grain.reverse = false;
+        grain.fadeGain = 1.0f;
+        grain.fadeStep = 0.0f;
     }
+
+    grainAllocator.reset();
+    stealFadeStep = 1.0f / static_cast<float>(sampleRate * 0.002);
 }
 
 void ScatterAudioProcessor::releaseResources()
@@ -156,6 +166,10 @@ void ScatterAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     for (int i = getTotalNumInputChannels(); i < getTotalNumOutputChannels(); ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
+    // Offline bounce: allow a denser cloud before grains get stolen
+    renderQuality.update(*this);
+    grainAllocator.setVoiceLimit(renderQuality.select(maxGrainVoices, maxOfflineGrainVoices));
+
     // Read parameters (atomic, real-time safe)
     auto* delayTimeParam = parameters.getRawParameterValue("delay_time");
     auto* grainSizeParam = parameters.getRawParameterValue("grain_size");
@@ -180,6 +194,14 @@ void ScatterAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
 
+    // Tail: the delay buffer plus the feedback loop (one grain per pass) decaying by 60dB
+    const double grainSeconds = grainSizeMs / 1000.0;
+    tailTracker.setTailLengthSeconds(2.0 + grainSeconds + TailTracker::feedbackTailSeconds(grainSeconds, feedbackGain));
+
+    // Idle: input silent and the tail has died away - skip all DSP
+    if (tailTracker.processInput(buffer, getTotalNumInputChannels()))
+        return;
+
     // Phase 3.3: Step 1 - Capture dry signal
     juce::dsp::AudioBlock<float> block(buffer);
     dryWetMixer.pushDrySamples(block);
@@ -229,6 +251,8 @@ void ScatterAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     // Phase 3.3: Step 7 - Blend with dry signal using dry/wet mixer
     dryWetMixer.setWetMixProportion(mixValue);
     dryWetMixer.mixWetSamples(block);
+
+    tailTracker.processOutput(buffer);
 }
 
 juce::AudioProcessorEditor* ScatterAudioProcessor::createEditor()
@@ -316,23 +340,18 @@ void ScatterAudioProcessor::spawnNewGrain(float grainSizeMs, float pitchRandomPe
     // Clamp to valid range (avoid zero or negative sizes)
     grainSizeSamples = juce::jmax(1, grainSizeSamples);
 
-    // Find inactive voice (voice allocation)
-    GrainVoice* availableVoice = nullptr;
-
-    for (auto& grain : grainVoices)
-    {
-        if (!grain.active)
+    // Take a free voice; when all are sounding, the grain nearest its end fades out
+    const int voiceIndex = grainAllocator.allocate(
+        grainSizeSamples,
+        [this](int index)
         {
-            availableVoice = &grain;
-            break;
-        }
-    }
+            grainVoices[static_cast<size_t>(index)].fadeStep = stealFadeStep;
+        });
 
-    // If no voices available, steal the first voice (simple voice stealing)
-    if (availableVoice == nullptr)
-    {
-        availableVoice = &grainVoices[0];
-    }
+    if (voiceIndex == GrainAllocator<grainPoolSize>::noSlot)
+        return;  // Even the fade-out reserve is busy
+
+    GrainVoice* availableVoice = &grainVoices[static_cast<size_t>(voiceIndex)];
 
     // Get random number generator
     auto& random = juce::Random::getSystemRandom();
@@ -358,6 +377,8 @@ void ScatterAudioProcessor::spawnNewGrain(float grainSizeMs, float pitchRandomPe
     availableVoice->playbackRate = playbackRate;
     availableVoice->pan = pan;
     availableVoice->reverse = reverse;
+    availableVoice->fadeGain = 1.0f;
+    availableVoice->fadeStep = 0.0f;
 
     // Read position: Start at current delay buffer write position
     availableVoice->readPosition = 0.0f;
@@ -405,19 +426,20 @@ void ScatterAudioProcessor::processGrainVoices(juce::AudioBuffer<float>& buffer)
     // Clear output buffer (grains will be summed into it)
     buffer.clear();
 
-    // Process each active grain voice
-    for (auto& grain : grainVoices)
+    // Process each playing grain voice (backwards, so finished grains can be released in place)
+    for (int i = grainAllocator.getNumPlaying(); --i >= 0;)
     {
-        if (!grain.active)
-            continue;
+        const int voiceIndex = grainAllocator.getPlaying(i);
+        auto& grain = grainVoices[static_cast<size_t>(voiceIndex)];
 
         // For each sample in the buffer
         for (int sample = 0; sample < numSamples; ++sample)
         {
-            // Check if grain has completed
-            if (grain.windowPosition >= 1.0f)
+            // Check if grain has completed (window done, or faded out after being stolen)
+            if (grain.windowPosition >= 1.0f || grain.fadeGain <= 0.0f)
             {
                 grain.active = false;
+                grainAllocator.release(voiceIndex);
                 break;
             }
 
@@ -437,8 +459,9 @@ void ScatterAudioProcessor::processGrainVoices(juce::AudioBuffer<float>& buffer)
             float delaySamples = grain.readPosition;
             float delayedSample = delayBuffer.popSample(0, delaySamples);
 
-            // Apply window envelope
-            float grainOutput = delayedSample * windowValue;
+            // Apply window envelope (and steal fade)
+            float grainOutput = delayedSample * windowValue * grain.fadeGain;
+            grain.fadeGain -= grain.fadeStep;
 
             // Phase 3.3: Apply stereo panning
             float leftGain = 1.0f - grain.pan;   // pan=0.0 → leftGain=1.0, pan=1.0 → leftGain=0.0
@@ -486,6 +509,9 @@ void ScatterAudioProcessor::processGrainVoices(juce::AudioBuffer<float>& buffer)
             }
         }
     }
+
+    // Grain end times are kept on the allocator's clock
+    grainAllocator.advance(numSamples);
 }
 
 // ============================================================================
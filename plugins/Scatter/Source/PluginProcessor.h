@@ -1,6 +1,9 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "TailTracker.h"
+#include "RenderQuality.h"
+#include "GrainAllocator.h"
 #include <array>
 #include <vector>
 
@@ -21,7 +24,7 @@ public:
     bool acceptsMidi() const override { return false; }
     bool producesMidi() const override { return false; }
     bool isMidiEffect() const override { return false; }
-    double getTailLengthSeconds() const override { return 0.0; }
+    double getTailLengthSeconds() const override { return tailTracker.getTailLengthSeconds(); }
 
     int getNumPrograms() override { return 1; }
     int getCurrentProgram() override { return 0; }
@@ -60,6 +63,8 @@ private:
         float pan = 0.5f;               // Phase 3.3: Pan position (0.0 = left, 1.0 = right)
         bool reverse = false;           // Phase 3.3: Reverse playback flag
         bool active = false;            // Is this voice currently playing?
+        float fadeGain = 1.0f;          // Quick fade-out when stolen (fadeStep 0 = not fading)
+        float fadeStep = 0.0f;
     };
 
     // DSP components (declare BEFORE parameters for initialization order)
@@ -68,9 +73,16 @@ private:
     // Granular delay buffer (Lagrange3rd interpolation for future pitch shifting)
     juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> delayBuffer;
 
-    // Grain voice pool (64 pre-allocated voices)
+    // Grain voice pool (64 voices live, 128 while bouncing offline - all pre-allocated),
+    // plus a few reserve slots where stolen grains fade out
     static constexpr int maxGrainVoices = 64;
-    std::array<GrainVoice, maxGrainVoices> grainVoices;
+    static constexpr int maxOfflineGrainVoices = 128;
+    static constexpr int grainReserveSlots = 4;
+    static constexpr int grainPoolSize = maxOfflineGrainVoices + grainReserveSlots;
+    std::array<GrainVoice, grainPoolSize> grainVoices;
+    GrainAllocator<grainPoolSize> grainAllocator;
+    float stealFadeStep = 0.0f;  // Per-sample fade for stolen grains (~2ms)
+    RenderQuality renderQuality;
 
     // Grain scheduler state
     int grainSpawnCounter = 0;         // Sample counter for grain spawning
@@ -92,6 +104,9 @@ private:
     juce::dsp::DryWetMixer<float> dryWetMixer;
     juce::AudioBuffer<float> feedbackBuffer;
 
+    // Tail length for the host + idle bypass once input and tail are silent
+    TailTracker tailTracker;
+
     // Helper methods
     void spawnNewGrain(float grainSizeMs, float pitchRandomPercent, float panRandomPercent, int scaleIndex, int rootNote);
     void updateGrainScheduler(float densityPercent, float grainSizeMs, float pitchRandomPercent, float panRandomPercent, int scaleIndex, int rootNote);
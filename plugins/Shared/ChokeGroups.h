@@ -0,0 +1,102 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+// Choke groups: a note-on can silence every voice currently registered in a
+// group (e.g. closed hi-hat cuts open hi-hat).
+//
+// Voices are identified by index. Membership changes are O(1) (swap-remove),
+// and a choke only touches the voices actually in the choked group - no scan
+// over the whole voice pool. Call noteOn() from inside the render loop at the
+// event's sample position so the choke lands sample-accurately.
+class ChokeGroups
+{
+public:
+    static constexpr int maxGroups = 16;
+    static constexpr int maxVoices = 64;
+    static constexpr int noGroup = -1;
+
+    ChokeGroups()
+    {
+        noteGroup.fill(noGroup);
+        noteChokesGroup.fill(noGroup);
+        voiceGroup.fill(noGroup);
+        voiceSlot.fill(0);
+    }
+
+    // Voices playing midiNote join group and can be choked by it
+    void setNoteGroup(int midiNote, int group) { noteGroup[(size_t) midiNote] = (int8_t) group; }
+
+    // A note-on of midiNote chokes every voice in group
+    void setNoteChokesGroup(int midiNote, int group) { noteChokesGroup[(size_t) midiNote] = (int8_t) group; }
+
+    // Call when voiceIndex starts playing midiNote (moves it to the note's group)
+    void voiceStarted(int voiceIndex, int midiNote)
+    {
+        removeVoice(voiceIndex);
+
+        const int group = noteGroup[(size_t) midiNote];
+        if (group == noGroup)
+            return;
+
+        auto& g = groups[(size_t) group];
+        voiceGroup[(size_t) voiceIndex] = (int8_t) group;
+        voiceSlot[(size_t) voiceIndex] = (int8_t) g.numMembers;
+        g.members[(size_t) g.numMembers++] = (int8_t) voiceIndex;
+    }
+
+    // Call when voiceIndex goes idle
+    void voiceStopped(int voiceIndex) { removeVoice(voiceIndex); }
+
+    // Chokes the group targeted by midiNote; chokeVoice(int voiceIndex) is called per member
+    template <typename ChokeFn>
+    void noteOn(int midiNote, ChokeFn&& chokeVoice)
+    {
+        const int group = noteChokesGroup[(size_t) midiNote];
+        if (group == noGroup)
+            return;
+
+        auto& g = groups[(size_t) group];
+        while (g.numMembers > 0)
+        {
+            const int voiceIndex = g.members[(size_t) --g.numMembers];
+            voiceGroup[(size_t) voiceIndex] = noGroup;
+            chokeVoice(voiceIndex);
+        }
+    }
+
+    // Forget all memberships (note/group configuration is kept)
+    void reset()
+    {
+        voiceGroup.fill(noGroup);
+        for (auto& g : groups)
+            g.numMembers = 0;
+    }
+
+private:
+    struct Group
+    {
+        std::array<int8_t, maxVoices> members {};
+        int numMembers = 0;
+    };
+
+    void removeVoice(int voiceIndex)
+    {
+        const int group = voiceGroup[(size_t) voiceIndex];
+        if (group == noGroup)
+            return;
+
+        auto& g = groups[(size_t) group];
+        const int slot = voiceSlot[(size_t) voiceIndex];
+        const int8_t last = g.members[(size_t) --g.numMembers];
+        g.members[(size_t) slot] = last;
+        voiceSlot[(size_t) last] = (int8_t) slot;
+        voiceGroup[(size_t) voiceIndex] = noGroup;
+    }
+
+    std::array<int8_t, 128> noteGroup;
+    std::array<int8_t, 128> noteChokesGroup;
+    std::array<int8_t, maxVoices> voiceGroup;
+    std::array<int8_t, maxVoices> voiceSlot;
+    std::array<Group, maxGroups> groups;
+};
@@ -0,0 +1,142 @@
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+#include <vector>
+
+// Bipolar DJ-style "tilt" filter: -100% = low-pass at 200Hz, 0% = bypass,
+// +100% = high-pass at 10kHz (Butterworth Q, exponential cutoff mapping).
+//
+// TPT state-variable formulation: no coefficient objects (nothing allocated on
+// the audio thread) and stable under fast modulation, so the cutoff coefficient
+// g is interpolated per sample across each block instead of jumping. Cutoff
+// maths only runs when the amount actually changes.
+class DJFilter
+{
+public:
+    void prepare(const juce::dsp::ProcessSpec& spec)
+    {
+        sampleRate = spec.sampleRate;
+        s1.assign(spec.numChannels, 0.0f);
+        s2.assign(spec.numChannels, 0.0f);
+        lastAmount = 0.0f;
+        mode = Mode::Bypass;
+    }
+
+    void reset()
+    {
+        std::fill(s1.begin(), s1.end(), 0.0f);
+        std::fill(s2.begin(), s2.end(), 0.0f);
+    }
+
+    // filterPercent: -100 to +100, bypass zone |filterPercent| <= 0.5
+    void setFilterAmount(float filterPercent)
+    {
+        if (filterPercent == lastAmount)
+            return;
+
+        lastAmount = filterPercent;
+
+        Mode newMode = Mode::Bypass;
+        float cutoffHz = 0.0f;
+
+        if (filterPercent < -0.5f)
+        {
+            // Exponential mapping: 0% = 20kHz, -100% = 200Hz
+            float normalizedValue = std::abs(filterPercent) / 100.0f;
+            cutoffHz = juce::jlimit(200.0f, 20000.0f, 20000.0f * std::pow(10.0f, -normalizedValue * std::log10(100.0f)));
+            newMode = Mode::LowPass;
+        }
+        else if (filterPercent > 0.5f)
+        {
+            // Exponential mapping: 0% = 20Hz, +100% = 10kHz
+            float normalizedValue = filterPercent / 100.0f;
+            cutoffHz = juce::jlimit(20.0f, 10000.0f, 20.0f * std::pow(10.0f, normalizedValue * std::log10(500.0f)));
+            newMode = Mode::HighPass;
+        }
+
+        if (newMode == Mode::Bypass)
+        {
+            mode = newMode;
+            return;
+        }
+
+        cutoffHz = juce::jmin(cutoffHz, static_cast<float>(sampleRate * 0.49));
+        targetG = std::tan(juce::MathConstants<float>::pi * cutoffHz / static_cast<float>(sampleRate));
+
+        // Entering from bypass or flipping LP/HP: start clean at the new cutoff
+        if (newMode != mode)
+        {
+            reset();
+            currentG = targetG;
+            mode = newMode;
+        }
+    }
+
+    bool isBypassed() const { return mode == Mode::Bypass; }
+
+    void process(juce::dsp::AudioBlock<float> block)
+    {
+        if (mode == Mode::Bypass)
+            return;
+
+        const auto numChannels = juce::jmin(block.getNumChannels(), s1.size());
+        const auto numSamples = static_cast<int>(block.getNumSamples());
+        const bool isLowPass = (mode == Mode::LowPass);
+        const float startG = currentG;
+        const float gStep = (targetG - startG) / static_cast<float>(juce::jmax(1, numSamples));
+
+        for (size_t channel = 0; channel < numChannels; ++channel)
+        {
+            auto* data = block.getChannelPointer(channel);
+            float z1 = s1[channel];
+            float z2 = s2[channel];
+
+            if (gStep == 0.0f)
+            {
+                // Settled: coefficients are constant for the whole block
+                const float g = startG;
+                const float h = 1.0f / (1.0f + g * (g + k));
+
+                for (int i = 0; i < numSamples; ++i)
+                    data[i] = tick(data[i], g, h, z1, z2, isLowPass);
+            }
+            else
+            {
+                // Gliding: interpolate g per sample (TPT stays stable for any g > 0)
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    const float g = startG + gStep * static_cast<float>(i + 1);
+                    const float h = 1.0f / (1.0f + g * (g + k));
+                    data[i] = tick(data[i], g, h, z1, z2, isLowPass);
+                }
+            }
+
+            s1[channel] = z1;
+            s2[channel] = z2;
+        }
+
+        currentG = targetG;
+    }
+
+private:
+    enum class Mode { Bypass, LowPass, HighPass };
+
+    static float tick(float x, float g, float h, float& z1, float& z2, bool lowPass) noexcept
+    {
+        const float hp = (x - (g + k) * z1 - z2) * h;
+        const float bp = g * hp + z1;
+        const float lp = g * bp + z2;
+        z1 = g * hp + bp;
+        z2 = g * bp + lp;
+        return lowPass ? lp : hp;
+    }
+
+    static constexpr float k = 1.41421356f;  // 1/Q, Q = 0.707 (Butterworth)
+
+    double sampleRate = 44100.0;
+    Mode mode = Mode::Bypass;
+    float lastAmount = 0.0f;
+    float currentG = 0.0f;
+    float targetG = 0.0f;
+
+    std::vector<float> s1, s2;  // Per-channel integrator states
+};
@@ -0,0 +1,189 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <array>
+
+// Grain slot allocator for granular engines with a fixed voice pool.
+//
+// Free slots form a singly linked list threaded through per-slot links, so
+// finding and returning a slot is O(1). Occupied slots are also kept in a dense
+// "playing" list (swap-remove), so render loops touch only grains that are
+// actually sounding.
+//
+// When the sounding-grain limit is reached, the grain closest to the end of
+// its window is stolen: it is handed back to the caller to fade out quickly
+// (startFadeOut) and keeps its slot until the caller releases it. Capacity
+// should therefore exceed the largest voice limit by a few reserve slots for
+// fading grains; if even those are busy, the spawn is skipped rather than
+// hard-cutting anything.
+//
+// Finding that grain doesn't scan the pool: sounding grains sit in an indexed
+// binary min-heap keyed on the sample their window ends (the allocator keeps
+// the clock, the caller advances it), so stealing reads the top and every
+// insert/removal is O(log n) - a full pool costs a few sift steps per spawn,
+// not a pass over every playing grain.
+template <int Capacity>
+class GrainAllocator
+{
+public:
+    static constexpr int noSlot = -1;
+
+    GrainAllocator() { reset(); }
+
+    // Everything free
+    void reset()
+    {
+        for (int i = 0; i < Capacity; ++i)
+        {
+            nextFree[(size_t) i] = (i + 1 < Capacity) ? i + 1 : noSlot;
+            fading[(size_t) i] = false;
+        }
+
+        freeHead = 0;
+        numPlaying = 0;
+        numSounding = 0;
+        clock = 0;
+    }
+
+    // Maximum grains sounding at once (fading grains don't count)
+    void setVoiceLimit(int newLimit) { voiceLimit = juce::jlimit(1, Capacity, newLimit); }
+
+    // Moves the allocator's clock on as the caller renders (grain end times are relative to it)
+    void advance(int numSamples) { clock += numSamples; }
+
+    // Returns a slot for a grain lasting lengthSamples from now, or noSlot. When the
+    // limit is reached, the sounding grain that ends soonest is passed to
+    // startFadeOut(slot) first; the caller releases it once the fade is done.
+    template <typename FadeFn>
+    int allocate(int lengthSamples, FadeFn&& startFadeOut)
+    {
+        if (numSounding >= voiceLimit && numSounding > 0)
+        {
+            const int victim = heap[0];
+            heapRemove(victim);
+            fading[(size_t) victim] = true;
+            startFadeOut(victim);
+        }
+
+        if (freeHead == noSlot || numSounding >= voiceLimit)
+            return noSlot;
+
+        const int slot = freeHead;
+        freeHead = nextFree[(size_t) slot];
+
+        playingIndex[(size_t) slot] = numPlaying;
+        playing[(size_t) numPlaying++] = slot;
+
+        endTime[(size_t) slot] = clock + lengthSamples;
+        heapInsert(slot);
+        return slot;
+    }
+
+    // Call when a grain finishes (window done or fade-out done)
+    void release(int slot)
+    {
+        if (fading[(size_t) slot])
+            fading[(size_t) slot] = false;
+        else
+            heapRemove(slot);
+
+        // Swap-remove from the playing list
+        const int index = playingIndex[(size_t) slot];
+        const int last = playing[(size_t) --numPlaying];
+        playing[(size_t) index] = last;
+        playingIndex[(size_t) last] = index;
+
+        nextFree[(size_t) slot] = freeHead;
+        freeHead = slot;
+    }
+
+    // Occupied slots, for render loops. Iterate backwards so release() inside
+    // the loop only moves already-visited entries.
+    int getNumPlaying() const { return numPlaying; }
+    int getPlaying(int index) const { return playing[(size_t) index]; }
+
+private:
+    //==========================================================================
+    // Min-heap of sounding slots on endTime; heap[0..numSounding), heapIndex maps back
+    bool endsBefore(int a, int b) const { return endTime[(size_t) a] < endTime[(size_t) b]; }
+
+    void heapPlace(int index, int slot)
+    {
+        heap[(size_t) index] = slot;
+        heapIndex[(size_t) slot] = index;
+    }
+
+    void siftUp(int index)
+    {
+        const int slot = heap[(size_t) index];
+
+        while (index > 0)
+        {
+            const int parent = (index - 1) / 2;
+            if (! endsBefore(slot, heap[(size_t) parent]))
+                break;
+
+            heapPlace(index, heap[(size_t) parent]);
+            index = parent;
+        }
+
+        heapPlace(index, slot);
+    }
+
+    void siftDown(int index)
+    {
+        const int slot = heap[(size_t) index];
+
+        for (;;)
+        {
+            int child = 2 * index + 1;
+            if (child >= numSounding)
+                break;
+
+            if (child + 1 < numSounding && endsBefore(heap[(size_t) child + 1], heap[(size_t) child]))
+                ++child;
+
+            if (! endsBefore(heap[(size_t) child], slot))
+                break;
+
+            heapPlace(index, heap[(size_t) child]);
+            index = child;
+        }
+
+        heapPlace(index, slot);
+    }
+
+    void heapInsert(int slot)
+    {
+        heapPlace(numSounding, slot);
+        siftUp(numSounding++);
+    }
+
+    void heapRemove(int slot)
+    {
+        const int index = heapIndex[(size_t) slot];
+        const int last = heap[(size_t) --numSounding];
+
+        if (index == numSounding)
+            return;
+
+        // Move the last entry into the hole, then restore order whichever way it's off
+        heapPlace(index, last);
+        siftDown(index);
+        siftUp(heapIndex[(size_t) last]);
+    }
+
+    std::array<int, Capacity> nextFree {};
+    std::array<int, Capacity> playing {};
+    std::array<int, Capacity> playingIndex {};
+    std::array<bool, Capacity> fading {};
+
+    std::array<int, Capacity> heap {};
+    std::array<int, Capacity> heapIndex {};
+    std::array<juce::int64, Capacity> endTime {};  // Sample (on clock) the grain's window ends
+
+    int freeHead = 0;
+    int numPlaying = 0;
+    int numSounding = 0;  // Heap size: grains playing and not fading
+    int voiceLimit = Capacity;
+    juce::int64 clock = 0;
+};
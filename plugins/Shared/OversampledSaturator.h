@@ -0,0 +1,180 @@
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <memory>
+
+// tanh saturation with selectable oversampling (1x/2x/4x/8x).
+//
+// All oversamplers (polyphase IIR half-bands, integer latency; optionally also
+// linear-phase FIR half-bands) are built in prepare(), so switching quality or
+// filter type on the audio thread is just an index change.
+// The tanh is a clamped [7/6] Padé approximation written as a branch-free
+// loop over contiguous samples, which the compiler vectorises.
+class OversampledSaturator
+{
+public:
+    static constexpr int numQualities = 4;  // 1x, 2x, 4x, 8x
+
+    enum class FilterType { polyphaseIIR, linearPhaseFIR };
+
+    static juce::StringArray getQualityNames() { return { "1x", "2x", "4x", "8x" }; }
+
+    // includeLinearPhase also builds the FIR set (more memory; only if setFilterType() is used)
+    void prepare(const juce::dsp::ProcessSpec& spec, bool includeLinearPhase = false)
+    {
+        maxBlockSize = static_cast<size_t>(juce::jmax(1u, spec.maximumBlockSize));
+
+        for (size_t factor = 1; factor < numQualities; ++factor)
+        {
+            oversamplers[factor] = makeOversampler(spec, factor, juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR);
+
+            linearPhaseOversamplers[factor] = includeLinearPhase
+                ? makeOversampler(spec, factor, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple)
+                : nullptr;
+        }
+
+        if (! includeLinearPhase)
+            filterType = FilterType::polyphaseIIR;
+
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& os : oversamplers)
+            if (os != nullptr)
+                os->reset();
+
+        for (auto& os : linearPhaseOversamplers)
+            if (os != nullptr)
+                os->reset();
+    }
+
+    // 0 = 1x, 1 = 2x, 2 = 4x, 3 = 8x
+    void setQuality(int newQuality)
+    {
+        newQuality = juce::jlimit(0, numQualities - 1, newQuality);
+
+        if (newQuality == quality)
+            return;
+
+        quality = newQuality;
+        resetActive();
+    }
+
+    int getQuality() const { return quality; }
+
+    // Ignored (stays IIR) unless prepare() was called with includeLinearPhase
+    void setFilterType(FilterType newType)
+    {
+        if (newType == FilterType::linearPhaseFIR && linearPhaseOversamplers[1] == nullptr)
+            newType = FilterType::polyphaseIIR;
+
+        if (newType == filterType)
+            return;
+
+        filterType = newType;
+        resetActive();
+    }
+
+    FilterType getFilterType() const { return filterType; }
+
+    int getLatencyInSamples() const
+    {
+        auto* os = getActive();
+        return os != nullptr ? static_cast<int>(std::round(os->getLatencyInSamples())) : 0;
+    }
+
+    // y = tanh(gain * x), in place. Returns the output peak (|y| max, measured
+    // at the processing rate) so callers can meter without another pass.
+    // With shaping off the signal still passes through the oversampling
+    // filters, so latency stays constant; the returned peak is then 0.
+    float process(juce::dsp::AudioBlock<float> block, float gain, bool shaping = true)
+    {
+        auto* os = getActive();
+
+        if (os == nullptr)
+            return shaping ? shapeBlock(block, gain) : 0.0f;
+
+        // The oversampler's buffers only hold the prepared block size, so hosts that
+        // send bigger blocks are processed in prepared-size chunks
+        float peak = 0.0f;
+        const size_t numSamples = block.getNumSamples();
+
+        for (size_t start = 0; start < numSamples; start += maxBlockSize)
+        {
+            auto chunk = block.getSubBlock(start, juce::jmin(maxBlockSize, numSamples - start));
+            auto upBlock = os->processSamplesUp(chunk);
+
+            if (shaping)
+                peak = juce::jmax(peak, shapeBlock(upBlock, gain));
+
+            os->processSamplesDown(chunk);
+        }
+
+        return peak;
+    }
+
+    // Fused gain + clamped Padé [7/6] tanh + peak tracking in one branch-free pass.
+    // Error is below 1e-6 inside ±3, growing to ~1e-4 at the ±5 clamp (where tanh
+    // itself is within 1e-4 of 1), and saturating cleanly outside.
+    static float fastTanh(float* data, int numSamples, float gain) noexcept
+    {
+        float peak = 0.0f;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float x = juce::jlimit(-5.0f, 5.0f, data[i] * gain);
+            const float x2 = x * x;
+            const float numerator = x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+            const float denominator = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+            const float y = juce::jlimit(-1.0f, 1.0f, numerator / denominator);
+
+            data[i] = y;
+            peak = juce::jmax(peak, std::abs(y));
+        }
+
+        return peak;
+    }
+
+private:
+    static std::unique_ptr<juce::dsp::Oversampling<float>> makeOversampler(const juce::dsp::ProcessSpec& spec, size_t factor,
+                                                                        juce::dsp::Oversampling<float>::FilterType type)
+    {
+        auto os = std::make_unique<juce::dsp::Oversampling<float>>(
+            spec.numChannels, factor, type,
+            true,    // Max quality filters
+            true);   // Integer latency (exact host PDC)
+        os->initProcessing(spec.maximumBlockSize);
+        return os;
+    }
+
+    juce::dsp::Oversampling<float>* getActive() const
+    {
+        auto& set = (filterType == FilterType::linearPhaseFIR) ? linearPhaseOversamplers : oversamplers;
+        return set[(size_t) quality].get();
+    }
+
+    // Don't resume from stale filter state left from the last time this oversampler ran
+    void resetActive()
+    {
+        if (auto* os = getActive())
+            os->reset();
+    }
+
+    static float shapeBlock(juce::dsp::AudioBlock<float>& block, float gain)
+    {
+        float peak = 0.0f;
+
+        for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+            peak = juce::jmax(peak, fastTanh(block.getChannelPointer(channel), static_cast<int>(block.getNumSamples()), gain));
+
+        return peak;
+    }
+
+    std::array<std::unique_ptr<juce::dsp::Oversampling<float>>, numQualities> oversamplers;             // [0] unused (1x)
+    std::array<std::unique_ptr<juce::dsp::Oversampling<float>>, numQualities> linearPhaseOversamplers;  // Optional FIR set
+    size_t maxBlockSize = 1;  // Oversampler capacity (prepared block size)
+    int quality = 0;
+    FilterType filterType = FilterType::polyphaseIIR;
+};
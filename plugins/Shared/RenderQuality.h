@@ -0,0 +1,43 @@
+#pragma once
+#include <juce_audio_processors/juce_audio_processors.h>
+
+// Offline-render quality boost.
+//
+// Plugins call update() at the top of processBlock and pick their heavier
+// settings (more oversampling, linear-phase filters, more grains, better
+// interpolation) only while the host is bouncing - live playback keeps the
+// user's lighter settings, exports get the best without touching a knob.
+// Hosts set non-realtime mode before preparing a bounce, so plugins whose
+// latency depends on it also call update() from prepareToPlay: the latency is
+// then reported before the render starts, not midway through it.
+class RenderQuality
+{
+public:
+    // Returns true on the block where the host switched between realtime and offline
+    bool update(const juce::AudioProcessor& processor)
+    {
+        const bool nowOffline = processor.isNonRealtime();
+        const bool changed = nowOffline != offline;
+        offline = nowOffline;
+        return changed;
+    }
+
+    bool isOfflineRender() const { return offline; }
+
+    // The user's setting live; at least offlineMinimum while bouncing
+    template <typename T>
+    T atLeastWhenOffline(T realtimeValue, T offlineMinimum) const
+    {
+        return offline ? juce::jmax(realtimeValue, offlineMinimum) : realtimeValue;
+    }
+
+    // realtimeValue live, offlineValue while bouncing
+    template <typename T>
+    T select(T realtimeValue, T offlineValue) const
+    {
+        return offline ? offlineValue : realtimeValue;
+    }
+
+private:
+    bool offline = false;
+};
@@ -0,0 +1,105 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <atomic>
+#include <cmath>
+
+// Silence and tail tracking for effects whose output outlives their input.
+//
+// The owner sets the worst-case tail for its current settings (reported to the
+// host through getTailLengthSeconds()) and brackets processBlock with
+// processInput()/processOutput(). Once the input has been silent and the tail
+// has run out - or the output has stayed below the threshold for the hold
+// time - processInput() returns true and the block can skip all DSP. Any input
+// above the threshold wakes the effect again on the same block.
+class TailTracker
+{
+public:
+    static constexpr float silenceThreshold = 1.0e-5f;  // -100 dB
+
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        reset();
+    }
+
+    void reset()
+    {
+        idle = false;
+        silentInputSamples = 0;
+        quietOutputSamples = 0;
+    }
+
+    // Worst-case tail for the current settings (safe to read from any thread)
+    void setTailLengthSeconds(double seconds) { tailSeconds.store(juce::jmax(0.0, seconds), std::memory_order_relaxed); }
+    double getTailLengthSeconds() const { return tailSeconds.load(std::memory_order_relaxed); }
+
+    // Longest time the output can be quiet while something is still pending
+    // internally (e.g. audio travelling through a delay line). The output must
+    // stay quiet at least this long before going idle ahead of the full tail.
+    void setQuietHoldSeconds(double seconds) { quietHoldSeconds = juce::jmax(0.0, seconds); }
+
+    // Call at the top of processBlock. Returns true when the block can take the idle path.
+    bool processInput(const juce::AudioBuffer<float>& buffer, int numInputChannels)
+    {
+        const int numSamples = buffer.getNumSamples();
+
+        if (isAboveThreshold(buffer, juce::jmin(numInputChannels, buffer.getNumChannels())))
+        {
+            reset();
+            return false;
+        }
+
+        silentInputSamples += numSamples;
+        return idle;
+    }
+
+    // Call at the end of every block that was processed (not on the idle path)
+    void processOutput(const juce::AudioBuffer<float>& buffer)
+    {
+        if (silentInputSamples == 0)
+            return;  // Input still sounding
+
+        if (isAboveThreshold(buffer, buffer.getNumChannels()))
+            quietOutputSamples = 0;
+        else
+            quietOutputSamples += buffer.getNumSamples();
+
+        const auto tailSamples = static_cast<juce::int64>(getTailLengthSeconds() * sampleRate);
+        const auto holdSamples = static_cast<juce::int64>(quietHoldSeconds * sampleRate);
+
+        if (silentInputSamples >= tailSamples
+            || (silentInputSamples >= holdSamples && quietOutputSamples >= holdSamples))
+            idle = true;
+    }
+
+    bool isIdle() const { return idle; }
+
+    // Time for a feedback loop (period loopSeconds, gain per pass feedbackGain)
+    // to decay by 60 dB, including the first pass
+    static double feedbackTailSeconds(double loopSeconds, float feedbackGain)
+    {
+        if (feedbackGain <= 0.0f)
+            return loopSeconds;
+
+        const double passes = std::log(0.001) / std::log(juce::jmin(0.999, static_cast<double>(feedbackGain)));
+        return loopSeconds * (1.0 + std::ceil(passes));
+    }
+
+private:
+    static bool isAboveThreshold(const juce::AudioBuffer<float>& buffer, int numChannels)
+    {
+        for (int channel = 0; channel < numChannels; ++channel)
+            if (buffer.getMagnitude(channel, 0, buffer.getNumSamples()) > silenceThreshold)
+                return true;
+
+        return false;
+    }
+
+    double sampleRate = 44100.0;
+    std::atomic<double> tailSeconds { 0.0 };
+    double quietHoldSeconds = 0.1;
+
+    bool idle = false;
+    juce::int64 silentInputSamples = 0;
+    juce::int64 quietOutputSamples = 0;
+};
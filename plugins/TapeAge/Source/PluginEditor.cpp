@@ -26,6 +26,8 @@ TapeAgeAudioProcessorEditor::TapeAgeAudioProcessorEditor(TapeAgeAudioProcessor&
     ageRelay = std::make_unique<juce::WebSliderRelay>("age");
     mixRelay = std::make_unique<juce::WebSliderRelay>("mix");
     outputRelay = std::make_unique<juce::WebSliderRelay>("output");
+    oversamplingRelay = std::make_unique<juce::WebComboBoxRelay>("oversampling");
+    oversamplingFilterRelay = std::make_unique<juce::WebComboBoxRelay>("oversamplingFilter");
 
     // Initialize WebView with options
     webView = std::make_unique<juce::WebBrowserComponent>(
@@ -38,6 +40,8 @@ TapeAgeAudioProcessorEditor::TapeAgeAudioProcessorEditor(TapeAgeAudioProcessor&
             .withOptionsFrom(*ageRelay)
             .withOptionsFrom(*mixRelay)
             .withOptionsFrom(*outputRelay)
+            .withOptionsFrom(*oversamplingRelay)
+            .withOptionsFrom(*oversamplingFilterRelay)
             .withEventListener("jsLog", [](const auto& var) {
                 // Log JavaScript messages to file
                 if (var.isString())
@@ -63,6 +67,10 @@ TapeAgeAudioProcessorEditor::TapeAgeAudioProcessorEditor(TapeAgeAudioProcessor&
         *processorRef.parameters.getParameter("mix"), *mixRelay, nullptr);
     outputAttachment = std::make_unique<juce::WebSliderParameterAttachment>(
         *processorRef.parameters.getParameter("output"), *outputRelay, nullptr);
+    oversamplingAttachment = std::make_unique<juce::WebComboBoxParameterAttachment>(
+        *processorRef.parameters.getParameter("oversampling"), *oversamplingRelay, nullptr);
+    oversamplingFilterAttachment = std::make_unique<juce::WebComboBoxParameterAttachment>(
+        *processorRef.parameters.getParameter("oversamplingFilter"), *oversamplingFilterRelay, nullptr);
 
     debugLog.appendText("  Attachments created (sendInitialUpdate called)\n");
 
@@ -26,6 +26,8 @@ private:
     std::unique_ptr<juce::WebSliderRelay> ageRelay;
     std::unique_ptr<juce::WebSliderRelay> mixRelay;
     std::unique_ptr<juce::WebSliderRelay> outputRelay;
+    std::unique_ptr<juce::WebComboBoxRelay> oversamplingRelay;
+    std::unique_ptr<juce::WebComboBoxRelay> oversamplingFilterRelay;
 
     // 2️⃣ WEBVIEW SECOND (depends on relays via withOptionsFrom)
     std::unique_ptr<juce::WebBrowserComponent> webView;
@@ -36,6 +38,8 @@ private:
     std::unique_ptr<juce::WebSliderParameterAttachment> ageAttachment;
     std::unique_ptr<juce::WebSliderParameterAttachment> mixAttachment;
     std::unique_ptr<juce::WebSliderParameterAttachment> outputAttachment;
+    std::unique_ptr<juce::WebComboBoxParameterAttachment> oversamplingAttachment;
+    std::unique_ptr<juce::WebComboBoxParameterAttachment> oversamplingFilterAttachment;
 
     // Helper for resource serving
     std::optional<juce::WebBrowserComponent::Resource> getResource(const juce::String& url);
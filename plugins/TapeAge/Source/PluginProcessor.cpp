@@ -1,6 +1,19 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
+namespace
+{
+    // Wow/flutter depth (v1.1.0): ±25 cents at max age, flutter at 20% of wow depth
+    constexpr float maxPitchVariationCents = 25.0f;
+    constexpr float flutterDepthRatio = 0.2f;
+
+    // Delay excursion per unit depth, as in the original 100ms-centred design
+    constexpr double modulationReferenceSeconds = 0.1;
+
+    // Lagrange3rd reads a sample either side of the tap
+    constexpr float interpolationMarginSamples = 2.0f;
+}
+
 juce::AudioProcessorValueTreeState::ParameterLayout TapeAgeAudioProcessor::createParameterLayout()
 {
     juce::AudioProcessorValueTreeState::ParameterLayout layout;
@@ -37,6 +50,22 @@ juce::AudioProcessorValueTreeState::ParameterLayout TapeAgeAudioProcessor::creat
         1.0f  // Default: 100% wet
     ));
 
+    // oversampling - Saturation oversampling factor (default 2x, the original fixed setting)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "oversampling", 1 },
+        "Oversampling",
+        OversampledSaturator::getQualityNames(),
+        1
+    ));
+
+    // oversamplingFilter - Linear-phase FIR (original) or low-latency polyphase IIR
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "oversamplingFilter", 1 },
+        "Oversampling Filter",
+        juce::StringArray { "Linear Phase", "Low Latency" },
+        0
+    ));
+
     // output - Output gain trim (-12dB to +12dB)
     layout.add(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID { "output", 1 },
@@ -52,7 +81,6 @@ TapeAgeAudioProcessor::TapeAgeAudioProcessor()
     : AudioProcessor(BusesProperties()
                         .withInput("Input", juce::AudioChannelSet::stereo(), true)
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
-    , oversampler(2, 1, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple)  // 2x oversampling, 1 stage, FIR filters
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
 }
@@ -69,13 +97,19 @@ void TapeAgeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     currentSpec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
     currentSampleRate = sampleRate;
 
-    // Phase 4.1: Prepare oversampling engine
-    oversampler.initProcessing(static_cast<size_t>(samplesPerBlock));
-    oversampler.reset();
+    // Phase 4.1: Prepare oversampling engine (all factors, both filter types)
+    saturator.prepare(currentSpec, true);
 
     // Phase 4.2: Prepare wow/flutter modulation
-    // 200ms delay line buffer for pitch modulation (architecture.md line 28)
-    int delaySamples = static_cast<int>(sampleRate * 0.2);
+    // Pitch movement comes from how fast the delay changes, not from how deep it's
+    // centred, so the centre tap only needs to cover the widest swing (wow + flutter
+    // at AGE = 100%). Fixed for all AGE values so the reported latency never moves.
+    const float pitchVariationRatio = std::pow(2.0f, maxPitchVariationCents / 1200.0f) - 1.0f;
+    modulationScaleSamples = static_cast<float>(sampleRate * modulationReferenceSeconds);
+    const float maxExcursionSamples = (1.0f + flutterDepthRatio) * pitchVariationRatio * modulationScaleSamples;
+    modulationCentreSamples = std::ceil(maxExcursionSamples) + interpolationMarginSamples;
+
+    int delaySamples = static_cast<int>(modulationCentreSamples * 2.0f) + 4;
     delayLine.setMaximumDelayInSamples(delaySamples);
     delayLine.prepare(currentSpec);
     delayLine.reset();
@@ -91,13 +125,10 @@ void TapeAgeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     // Phase 4.3: Prepare degradation features
     // Initialize dropout state (no dropout at start)
     dropoutCountdown = static_cast<int>(sampleRate * 0.1);  // 100ms until first check
-    inDropout = false;
-    dropoutSamplesRemaining = 0;
-    dropoutEnvelope = 1.0f;
+    dropoutEnvelope.prepare(sampleRate, samplesPerBlock);
 
-    // Initialize noise filter state to zero
-    noiseFilterState[0] = 0.0f;
-    noiseFilterState[1] = 0.0f;
+    // Block hiss generator (per-channel noise state, scratch sized for the block)
+    hissGenerator.prepare(sampleRate, samplesPerBlock, static_cast<int>(currentSpec.numChannels));
 
     // v1.1.0: Prepare age-dependent high-frequency rolloff filters
     for (int i = 0; i < 2; ++i)
@@ -113,17 +144,47 @@ void TapeAgeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     dryWetMixer.prepare(currentSpec);
     dryWetMixer.reset();
 
-    // Set wet latency to compensate for oversampler + delay line latency
-    int oversamplerLatency = static_cast<int>(oversampler.getLatencyInSamples());
-    int delayLineLatency = static_cast<int>(sampleRate * 0.1);  // 100ms base delay from wow/flutter
-    int totalWetLatency = oversamplerLatency + delayLineLatency;
-    dryWetMixer.setWetLatency(static_cast<float>(totalWetLatency));
+    tailTracker.prepare(sampleRate);
+
+    // Wet latency compensation, host latency and tail for the current oversampling
+    updateOversampling();
+}
+
+void TapeAgeAudioProcessor::updateOversampling()
+{
+    auto* oversamplingParam = parameters.getRawParameterValue("oversampling");
+    auto* oversamplingFilterParam = parameters.getRawParameterValue("oversamplingFilter");
+
+    // Live: the user's choice. Bouncing: maximum quality (latency follows, reported below)
+    renderQuality.update(*this);
+
+    const bool lowLatencyFilter = renderQuality.select(oversamplingFilterParam->load() > 0.5f, false);
+
+    saturator.setQuality(renderQuality.atLeastWhenOffline(static_cast<int>(oversamplingParam->load()),
+                                                          OversampledSaturator::numQualities - 1));
+    saturator.setFilterType(lowLatencyFilter
+        ? OversampledSaturator::FilterType::polyphaseIIR
+        : OversampledSaturator::FilterType::linearPhaseFIR);
+
+    // Set wet latency to compensate for oversampler + delay line latency, and report the
+    // same total to the host so the whole plugin stays time-aligned
+    float totalWetLatency = static_cast<float>(saturator.getLatencyInSamples()) + modulationCentreSamples;
+    dryWetMixer.setWetLatency(totalWetLatency);
+
+    if (juce::roundToInt(totalWetLatency) != getLatencySamples())
+        setLatencySamples(juce::roundToInt(totalWetLatency));
+
+    // No feedback anywhere: the tail is the wet path latency (modulation delay +
+    // oversampling filters) plus the age filter's ring. Hiss is handled in processBlock.
+    const double tailSeconds = totalWetLatency / currentSampleRate + 0.05;
+    tailTracker.setTailLengthSeconds(tailSeconds);
+    tailTracker.setQuietHoldSeconds(tailSeconds);
 }
 
 void TapeAgeAudioProcessor::releaseResources()
 {
     // Phase 4.1: Reset DSP components
-    oversampler.reset();
+    saturator.reset();
 
     // Phase 4.2: Reset wow/flutter modulation
     delayLine.reset();
@@ -138,6 +199,21 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     for (int i = getTotalNumInputChannels(); i < getTotalNumOutputChannels(); ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
+    // Oversampling factor/filter can change at any time (latency follows)
+    updateOversampling();
+
+    // Tape hiss sounds on silent input too: while AGE adds hiss to a wet signal in
+    // the mix, the block always runs
+    const bool hissAudible = parameters.getRawParameterValue("age")->load() > 0.0f
+                          && parameters.getRawParameterValue("mix")->load() > 0.0f;
+
+    // Idle: input silent and the tail has died away - skip all DSP
+    if (tailTracker.processInput(buffer, getTotalNumInputChannels()) && ! hissAudible)
+    {
+        outputLevel.store(-100.0f, std::memory_order_relaxed);
+        return;
+    }
+
     // INPUT GAIN: Apply input trim FIRST (before any processing)
     auto* inputParam = parameters.getRawParameterValue("input");
     float inputDB = inputParam->load();
@@ -160,8 +236,8 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     // Phase 4.1: Core Saturation Processing
     // Processing chain:
     // 1. Read drive parameter and calculate gain
-    // 2. Upsample 2x
-    // 3. Apply tanh saturation manually (drive controls gain scaling)
+    // 2. Upsample (1x-8x, selectable)
+    // 3. Apply tanh saturation (drive controls gain scaling)
     // 4. Downsample
 
     // Read drive parameter (0.0 to 1.0)
@@ -189,26 +265,14 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         gain = 8.0f + ((drive - 0.7f) / 0.3f) * 12.0f;
     }
 
-    // Upsample
-    auto oversampledBlock = oversampler.processSamplesUp(block);
+    // Upsample, vectorised tanh approximation in the oversampled domain, downsample
+    saturator.process(block, gain);
 
-    // Apply tanh saturation manually in oversampled domain
     // Calculate makeup gain to compensate for volume increase (v1.1.0)
     // Simple empirical formula: reduce output level proportionally to gain
-    // This keeps perceived loudness roughly constant
+    // This keeps perceived loudness roughly constant (linear, so applied at base rate)
     float makeupGain = 1.0f / std::sqrt(gain);
-
-    for (size_t channel = 0; channel < oversampledBlock.getNumChannels(); ++channel)
-    {
-        auto* channelData = oversampledBlock.getChannelPointer(channel);
-        for (size_t sample = 0; sample < oversampledBlock.getNumSamples(); ++sample)
-        {
-            channelData[sample] = std::tanh(gain * channelData[sample]) * makeupGain;
-        }
-    }
-
-    // Downsample back to original sample rate
-    oversampler.processSamplesDown(block);
+    block.multiplyBy(makeupGain);
 
     // Phase 4.2: Wow/Flutter Modulation
     // Processing chain: Apply pitch modulation via delay line after saturation
@@ -219,7 +283,6 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     // Calculate LFO modulation depth based on age
     // v1.1.0: Enhanced wow depth - ±25 cents at max age (was ±10 cents)
     // ±25 cents = 2^(25/1200) = 1.0145 (~1.45% pitch variation, still musical)
-    const float maxPitchVariationCents = 25.0f;
     const float pitchVariationRatio = std::pow(2.0f, maxPitchVariationCents / 1200.0f) - 1.0f;  // ~0.0145
     float modulationDepth = age * pitchVariationRatio;
 
@@ -231,7 +294,6 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     // v1.1.0: Secondary flutter LFO at 6Hz for texture
     const float flutterFrequency = 6.0f;
     const float flutterPhaseIncrement = (flutterFrequency * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
-    const float flutterDepthRatio = 0.2f;  // 20% of wow depth
 
     // Process each channel
     const int numSamples = buffer.getNumSamples();
@@ -251,10 +313,9 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
             float combinedModulation = lfoValue + (flutterValue * flutterDepthRatio);
 
             // Calculate delay time in samples
-            // Base delay at center of buffer (100ms) + combined modulation
-            float baseDelaySamples = static_cast<float>(currentSampleRate) * 0.1f;  // 100ms center
-            float modulationSamples = combinedModulation * modulationDepth * baseDelaySamples;
-            float totalDelay = baseDelaySamples + modulationSamples;
+            // Minimal centre tap + combined modulation (never reaches below the interpolation margin)
+            float modulationSamples = combinedModulation * modulationDepth * modulationScaleSamples;
+            float totalDelay = modulationCentreSamples + modulationSamples;
 
             // Push input sample to delay line
             delayLine.pushSample(channel, channelData[sample]);
@@ -309,112 +370,28 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         // At age=1.0, probability = 0.02 (2% per 100ms check = ~20% per second = 5-10 second intervals)
         float dropoutProbability = age * 0.02f;
 
-        if (random.nextFloat() < dropoutProbability && !inDropout)
+        if (!dropoutEnvelope.isDropoutRunning() && random.nextFloat() < dropoutProbability)
         {
-            // Start dropout event
-            inDropout = true;
+            // Random attenuation factor 0.1-0.3 (70-90% reduction) (architecture.md line 40)
+            const float dropoutTargetGain = 0.1f + random.nextFloat() * 0.2f;
+
             // Random duration: 50-150ms (architecture.md line 39)
             float dropoutDurationMs = 50.0f + random.nextFloat() * 100.0f;
-            dropoutSamplesRemaining = static_cast<int>(currentSampleRate * dropoutDurationMs / 1000.0f);
-        }
-    }
-
-    // Process dropout envelope (smooth attack/release to avoid clicks)
-    if (inDropout && dropoutSamplesRemaining > 0)
-    {
-        // Random attenuation factor 0.1-0.3 (70-90% reduction) (architecture.md line 40)
-        const float dropoutTargetGain = 0.1f + random.nextFloat() * 0.2f;
-
-        // Envelope attack/release time: 5-10ms (architecture.md line 118)
-        const float envelopeTimeMs = 7.5f;  // Mid-range
-        const float envelopeTimeSamples = currentSampleRate * envelopeTimeMs / 1000.0f;
-        const float envelopeIncrement = 1.0f / envelopeTimeSamples;
-
-        for (int sample = 0; sample < numSamples && dropoutSamplesRemaining > 0; ++sample)
-        {
-            // Attack: Fade down to dropout gain
-            if (dropoutEnvelope > dropoutTargetGain)
-            {
-                dropoutEnvelope -= envelopeIncrement;
-                if (dropoutEnvelope < dropoutTargetGain)
-                    dropoutEnvelope = dropoutTargetGain;
-            }
-
-            // Apply dropout attenuation to all channels (stereo coherence)
-            for (int channel = 0; channel < numChannels; ++channel)
-            {
-                auto* channelData = buffer.getWritePointer(channel);
-                channelData[sample] *= dropoutEnvelope;
-            }
-
-            dropoutSamplesRemaining--;
-        }
-
-        if (dropoutSamplesRemaining <= 0)
-        {
-            // End dropout, start release
-            inDropout = false;
+            dropoutEnvelope.trigger(dropoutTargetGain, static_cast<int>(currentSampleRate * dropoutDurationMs / 1000.0f));
         }
     }
-    else if (dropoutEnvelope < 1.0f)
-    {
-        // Release: Fade back to full gain
-        const float envelopeTimeMs = 7.5f;
-        const float envelopeTimeSamples = currentSampleRate * envelopeTimeMs / 1000.0f;
-        const float envelopeIncrement = 1.0f / envelopeTimeSamples;
 
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            dropoutEnvelope += envelopeIncrement;
-            if (dropoutEnvelope >= 1.0f)
-            {
-                dropoutEnvelope = 1.0f;
-                break;
-            }
-
-            // Apply release envelope to all channels
-            for (int channel = 0; channel < numChannels; ++channel)
-            {
-                auto* channelData = buffer.getWritePointer(channel);
-                channelData[sample] *= dropoutEnvelope;
-            }
-        }
-    }
+    // Smooth attack/hold/release to avoid clicks (no-op while no dropout is running)
+    dropoutEnvelope.process(buffer, numSamples);
 
     // === Tape Noise Generator ===
     // Filtered white noise at subtle amplitude (architecture.md line 124-129)
     // v1.1.0: Increased noise floor for more present vintage character
     // Noise amplitude scaled by age: 0% = silent, 100% = -60dB
-
-    // Calculate noise gain based on age
-    // age = 0.0 → noiseGain = 0.0 (silent)
-    // age = 1.0 → noiseGain = 0.001 (-60dB, was -80dB)
     float noiseGain = age * 0.001f;  // Maximum -60dB at full age (subtle but more present)
 
     if (noiseGain > 0.0f)
-    {
-        // One-pole lowpass filter coefficient for ~8kHz cutoff (architecture.md line 125)
-        // Formula: coeff = 1 - exp(-2π * cutoffFreq / sampleRate)
-        const float cutoffFreq = 8000.0f;
-        const float filterCoeff = 1.0f - std::exp(-juce::MathConstants<float>::twoPi * cutoffFreq / static_cast<float>(currentSampleRate));
-
-        for (int channel = 0; channel < numChannels; ++channel)
-        {
-            auto* channelData = buffer.getWritePointer(channel);
-
-            for (int sample = 0; sample < numSamples; ++sample)
-            {
-                // Generate white noise: range [-1.0, 1.0]
-                float whiteNoise = random.nextFloat() * 2.0f - 1.0f;
-
-                // Apply one-pole lowpass filter (simulates tape frequency response)
-                noiseFilterState[channel] += filterCoeff * (whiteNoise - noiseFilterState[channel]);
-
-                // Add filtered noise at very low amplitude
-                channelData[sample] += noiseFilterState[channel] * noiseGain;
-            }
-        }
-    }
+        hissGenerator.process(buffer, numSamples, noiseGain);
 
     // Phase 4.4: Mix dry/wet signals AFTER all processing
     // Equal-power crossfade with latency compensation
@@ -443,6 +420,8 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         ? juce::Decibels::gainToDecibels(peakLevel)
         : -100.0f;
     outputLevel.store(peakDb, std::memory_order_relaxed);
+
+    tailTracker.processOutput(buffer);
 }
 
 juce::AudioProcessorEditor* TapeAgeAudioProcessor::createEditor()
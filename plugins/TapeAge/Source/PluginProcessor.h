@@ -1,6 +1,10 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "TailTracker.h"
+#include "OversampledSaturator.h"
+#include "RenderQuality.h"
+#include "TapeDegradation.h"
 
 class TapeAgeAudioProcessor : public juce::AudioProcessor
 {
@@ -19,7 +23,7 @@ public:
     bool acceptsMidi() const override { return false; }
     bool producesMidi() const override { return false; }
     bool isMidiEffect() const override { return false; }
-    double getTailLengthSeconds() const override { return 0.0; }
+    double getTailLengthSeconds() const override { return tailTracker.getTailLengthSeconds(); }
 
     int getNumPrograms() override { return 0; }
     int getCurrentProgram() override { return 0; }
@@ -41,7 +45,12 @@ private:
     juce::dsp::ProcessSpec currentSpec;
 
     // Phase 4.1: Core Saturation Processing
-    juce::dsp::Oversampling<float> oversampler { 2, 1, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple };
+    // Factor (1x-8x) and filter type (linear-phase FIR / polyphase IIR) are selectable;
+    // every combination is built in prepareToPlay, so switching is just an index change
+    OversampledSaturator saturator;
+
+    // Offline bounces always use 8x linear-phase oversampling
+    RenderQuality renderQuality;
 
     // Phase 4.2: Wow/Flutter Modulation
     juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> delayLine;
@@ -49,17 +58,23 @@ private:
     float flutterPhase[2] { 0.0f, 0.0f };  // Secondary flutter LFO phase per channel (v1.1.0)
     juce::Random random;
     double currentSampleRate { 44100.0 };
+    float modulationCentreSamples { 0.0f };  // Centre tap: just deep enough for the widest wow/flutter swing
+    float modulationScaleSamples { 0.0f };   // Excursion per unit depth (keeps the original pitch movement)
 
     // Phase 4.3: Degradation Features (Dropout + Noise + High-frequency Rolloff)
     int dropoutCountdown { 0 };  // Samples until next dropout check
-    bool inDropout { false };  // Dropout state flag
-    int dropoutSamplesRemaining { 0 };  // Current dropout duration
-    float dropoutEnvelope { 1.0f };  // Smooth attack/release (1.0 = no attenuation)
-    float noiseFilterState[2] { 0.0f, 0.0f };  // One-pole lowpass filter state per channel
+    DropoutEnvelope dropoutEnvelope;  // Smooth attack/release gain dips
+    TapeHissGenerator hissGenerator;  // Block-based coloured noise
     juce::dsp::IIR::Filter<float> ageFilter[2];  // High-frequency rolloff per channel (v1.1.0)
 
     // Phase 4.4: Dry/Wet Mixing
-    juce::dsp::DryWetMixer<float> dryWetMixer { 20000 };  // Max latency: 192kHz * 0.1s delay line + oversampler
+    juce::dsp::DryWetMixer<float> dryWetMixer { 1024 };  // Max latency: modulation centre (~2ms) + oversampler
+
+    // Tail length for the host + idle bypass once input and tail are silent
+    TailTracker tailTracker;
+
+    // Applies the oversampling params and keeps mixer/host latency and tail in sync
+    void updateOversampling();
 
     // Parameter layout creation
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
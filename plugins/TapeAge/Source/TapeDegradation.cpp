@@ -0,0 +1,132 @@
+#include "TapeDegradation.h"
+
+//==============================================================================
+void TapeHissGenerator::prepare(double sampleRate, int maxBlockSizeToUse, int numChannels)
+{
+    // One-pole lowpass coefficient for ~8kHz cutoff (architecture.md line 125)
+    // Formula: coeff = 1 - exp(-2π * cutoffFreq / sampleRate)
+    const float cutoffFreq = 8000.0f;
+    filterCoeff = 1.0f - std::exp(-juce::MathConstants<float>::twoPi * cutoffFreq / static_cast<float>(sampleRate));
+
+    maxBlockSize = juce::jmax(1, maxBlockSizeToUse);
+    const int roundedSize = (maxBlockSize + numLanes - 1) / numLanes * numLanes;
+    noiseBlock.allocate(static_cast<size_t>(roundedSize), true);
+
+    channels.assign(static_cast<size_t>(numChannels), {});
+
+    // Distinct non-zero seeds for every lane of every channel
+    juce::Random seeder;
+    for (auto& channel : channels)
+        for (auto& seed : channel.seeds)
+            seed = static_cast<uint32_t>(seeder.nextInt()) | 1u;
+}
+
+void TapeHissGenerator::reset()
+{
+    for (auto& channel : channels)
+        channel.filterState = 0.0f;
+}
+
+void TapeHissGenerator::process(juce::AudioBuffer<float>& buffer, int numSamples, float gain)
+{
+    // Noise scratch holds maxBlockSize samples; larger host blocks run in chunks
+    for (int start = 0; start < numSamples; start += maxBlockSize)
+        processChunk(buffer, start, juce::jmin(maxBlockSize, numSamples - start), gain);
+}
+
+void TapeHissGenerator::processChunk(juce::AudioBuffer<float>& buffer, int startSample, int numSamples, float gain)
+{
+    const int numChannels = juce::jmin(buffer.getNumChannels(), static_cast<int>(channels.size()));
+    const int numGroups = (numSamples + numLanes - 1) / numLanes;
+    constexpr float scale = 1.0f / 2147483648.0f;  // int32 -> [-1, 1)
+
+    float* noise = noiseBlock.get();
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        auto& state = channels[static_cast<size_t>(channel)];
+
+        // 1. White noise: lanes are independent, so this loop vectorises
+        auto seeds = state.seeds;
+        for (int group = 0; group < numGroups; ++group)
+        {
+            for (int lane = 0; lane < numLanes; ++lane)
+            {
+                uint32_t x = seeds[(size_t) lane];
+                x ^= x << 13;
+                x ^= x >> 17;
+                x ^= x << 5;
+                seeds[(size_t) lane] = x;
+                noise[group * numLanes + lane] = static_cast<float>(static_cast<int32_t>(x)) * scale;
+            }
+        }
+        state.seeds = seeds;
+
+        // 2. Colour: one-pole lowpass (simulates tape frequency response)
+        float z = state.filterState;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            z += filterCoeff * (noise[i] - z);
+            noise[i] = z;
+        }
+        state.filterState = z;
+
+        // 3. Add at hiss level
+        juce::FloatVectorOperations::addWithMultiply(buffer.getWritePointer(channel, startSample), noise, gain, numSamples);
+    }
+}
+
+//==============================================================================
+void DropoutEnvelope::prepare(double sampleRate, int maxBlockSize)
+{
+    // Envelope attack/release time: 5-10ms (architecture.md line 118), mid-range
+    const float envelopeTimeMs = 7.5f;
+    rampStep = 1.0f / (static_cast<float>(sampleRate) * envelopeTimeMs / 1000.0f);
+
+    gainCurveSize = juce::jmax(1, maxBlockSize);
+    gainCurve.allocate(static_cast<size_t>(gainCurveSize), true);
+
+    reset();
+}
+
+void DropoutEnvelope::reset()
+{
+    envelope = 1.0f;
+    dropoutGain = 1.0f;
+    samplesRemaining = 0;
+}
+
+void DropoutEnvelope::trigger(float depthGain, int durationSamples)
+{
+    if (samplesRemaining > 0)
+        return;
+
+    dropoutGain = depthGain;
+    samplesRemaining = durationSamples;
+}
+
+void DropoutEnvelope::process(juce::AudioBuffer<float>& buffer, int numSamples)
+{
+    // Gain curve holds gainCurveSize samples; larger host blocks run in chunks so the
+    // whole block is shaped and the envelope keeps time
+    for (int start = 0; start < numSamples && isActive(); start += gainCurveSize)
+        processChunk(buffer, start, juce::jmin(gainCurveSize, numSamples - start));
+}
+
+void DropoutEnvelope::processChunk(juce::AudioBuffer<float>& buffer, int startSample, int numSamples)
+{
+    float* gains = gainCurve.get();
+
+    // Ramp toward the dropout gain while it lasts, then back to 1 (no per-phase branches)
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float target = samplesRemaining > 0 ? dropoutGain : 1.0f;
+        envelope += juce::jlimit(-rampStep, rampStep, target - envelope);
+        samplesRemaining -= (samplesRemaining > 0 ? 1 : 0);
+        gains[i] = envelope;
+    }
+
+    // Same curve on all channels (stereo coherence)
+    for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        juce::FloatVectorOperations::multiply(buffer.getWritePointer(channel, startSample), gains, numSamples);
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <vector>
+
+// Tape hiss: a whole block of coloured noise per channel at once.
+//
+// White noise comes from four interleaved xorshift32 generators per channel
+// (independent lanes, so the loop vectorises), is coloured by a one-pole
+// low-pass (~8kHz tape response) and added to the signal with one vector op.
+class TapeHissGenerator
+{
+public:
+    void prepare(double sampleRate, int maxBlockSize, int numChannels);
+    void reset();
+
+    // Adds hiss at the given linear gain to the first numSamples of every channel
+    // (any length: blocks beyond the prepared size run in chunks)
+    void process(juce::AudioBuffer<float>& buffer, int numSamples, float gain);
+
+private:
+    static constexpr int numLanes = 4;
+
+    void processChunk(juce::AudioBuffer<float>& buffer, int startSample, int numSamples, float gain);
+
+    struct ChannelState
+    {
+        std::array<uint32_t, numLanes> seeds {};
+        float filterState = 0.0f;
+    };
+
+    std::vector<ChannelState> channels;
+    juce::HeapBlock<float> noiseBlock;  // maxBlockSize rounded up to whole lane groups
+    int maxBlockSize = 1;
+    float filterCoeff = 0.0f;
+};
+
+// Tape dropouts: gain dips with a linear attack/release ramp.
+//
+// A single per-sample update (ramp toward the current target, clamped to the
+// ramp rate) covers attack, hold and release alike; the resulting gain curve
+// is applied to every channel with vector multiplies. Costs nothing while no
+// dropout is running.
+class DropoutEnvelope
+{
+public:
+    void prepare(double sampleRate, int maxBlockSize);
+    void reset();
+
+    // Starts a dropout to depthGain lasting durationSamples (ignored if one is running)
+    void trigger(float depthGain, int durationSamples);
+
+    bool isDropoutRunning() const { return samplesRemaining > 0; }
+    bool isActive() const { return samplesRemaining > 0 || envelope < 1.0f; }
+
+    // Any length: blocks beyond the prepared size run in chunks
+    void process(juce::AudioBuffer<float>& buffer, int numSamples);
+
+private:
+    void processChunk(juce::AudioBuffer<float>& buffer, int startSample, int numSamples);
+
+    juce::HeapBlock<float> gainCurve;
+    int gainCurveSize = 0;
+
+    float envelope = 1.0f;       // 1.0 = no attenuation
+    float rampStep = 0.0f;       // Max change per sample (7.5ms full-scale ramp)
+    float dropoutGain = 1.0f;
+    int samplesRemaining = 0;
+};